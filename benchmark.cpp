@@ -0,0 +1,223 @@
+// Benchmark harness for Vector: every hot operation is timed side by side
+// with std::vector on the same element type, so changes to vector.h can be
+// gated on numbers instead of gut feeling.
+//
+// Build: g++ -std=c++17 -O2 -DNDEBUG benchmark.cpp -o benchmark
+
+#include "vector.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+    /////_ELEMENT TYPES_/////////////////////////////////////
+    struct Pod { // trivially copyable, takes the memcpy fast paths
+        int64_t a = 0;
+        int64_t b = 0;
+    };
+
+    struct MoveOnly { // not copyable, forces the move path in reallocation
+        explicit MoveOnly(int v = 0)
+            :value(std::make_unique<int>(v)) {
+        }
+        MoveOnly(MoveOnly&&) noexcept = default;
+        MoveOnly& operator=(MoveOnly&&) noexcept = default;
+
+        std::unique_ptr<int> value;
+    };
+
+    struct ThrowingCopy { // move is not noexcept, so reallocation falls back to copying
+        ThrowingCopy() = default;
+        ThrowingCopy(const ThrowingCopy& other)
+            :payload(other.payload) {
+        }
+        ThrowingCopy(ThrowingCopy&& other)
+            :payload(std::move(other.payload)) {
+        }
+        ThrowingCopy& operator=(const ThrowingCopy&) = default;
+        ThrowingCopy& operator=(ThrowingCopy&&) = default;
+
+        std::string payload = "0123456789012345678901234567890123456789"; // defeats SSO
+    };
+
+    /////_TIMING_/////////////////////////////////////
+    using Clock = std::chrono::steady_clock;
+
+    // Runs the body several times and keeps the best wall time, which filters
+    // out scheduler noise without needing long runs.
+    template <typename Body>
+    double MeasureNs(Body&& body) {
+        double best = 1e300;
+        for (int run = 0; run < 3; ++run) {
+            auto start = Clock::now();
+            body();
+            auto stop = Clock::now();
+            double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+            best = std::min(best, ns);
+        }
+        return best;
+    }
+
+    void PrintRow(const std::string& name, size_t ops, size_t bytes_moved, double vec_ns, double std_ns) {
+        std::cout << std::left << std::setw(44) << name
+            << std::right << std::fixed << std::setprecision(2)
+            << std::setw(12) << vec_ns / ops << " ns/op"
+            << std::setw(12) << std_ns / ops << " ns/op"
+            << std::setw(10) << std::setprecision(1) << static_cast<double>(bytes_moved) / (1 << 20) << " MB"
+            << '\n';
+    }
+
+    /////_API ADAPTERS_/////////////////////////////////////
+    // Vector and std::vector spell the same operations differently.
+    template <typename T>
+    void Append(Vector<T>& c, T value) {
+        c.PushBack(std::move(value));
+    }
+    template <typename T>
+    void Append(std::vector<T>& c, T value) {
+        c.push_back(std::move(value));
+    }
+
+    template <typename T>
+    void ReserveIn(Vector<T>& c, size_t n) {
+        c.Reserve(n);
+    }
+    template <typename T>
+    void ReserveIn(std::vector<T>& c, size_t n) {
+        c.reserve(n);
+    }
+
+    /////_SCENARIOS_/////////////////////////////////////
+    template <typename T, typename MakeValue>
+    void BenchGrowth(const std::string& name, size_t n, MakeValue make) {
+        double vec_ns = MeasureNs([&] {
+            Vector<T> v;
+            for (size_t i = 0; i < n; ++i) {
+                v.PushBack(make(i));
+            }
+        });
+        double std_ns = MeasureNs([&] {
+            std::vector<T> v;
+            for (size_t i = 0; i < n; ++i) {
+                v.push_back(make(i));
+            }
+        });
+        PrintRow(name, n, 2 * n * sizeof(T), vec_ns, std_ns); // growth moves ~2n elements in total
+    }
+
+    template <typename T, typename MakeValue>
+    void BenchReserveFill(const std::string& name, size_t n, MakeValue make) {
+        double vec_ns = MeasureNs([&] {
+            Vector<T> v;
+            v.Reserve(n);
+            for (size_t i = 0; i < n; ++i) {
+                v.PushBack(make(i));
+            }
+        });
+        double std_ns = MeasureNs([&] {
+            std::vector<T> v;
+            v.reserve(n);
+            for (size_t i = 0; i < n; ++i) {
+                v.push_back(make(i));
+            }
+        });
+        PrintRow(name, n, n * sizeof(T), vec_ns, std_ns);
+    }
+
+    template <typename T, typename MakeValue>
+    void BenchInsertFront(const std::string& name, size_t n, MakeValue make) {
+        double vec_ns = MeasureNs([&] {
+            Vector<T> v;
+            v.Reserve(n);
+            for (size_t i = 0; i < n; ++i) {
+                v.Insert(v.begin(), make(i));
+            }
+        });
+        double std_ns = MeasureNs([&] {
+            std::vector<T> v;
+            v.reserve(n);
+            for (size_t i = 0; i < n; ++i) {
+                v.insert(v.begin(), make(i));
+            }
+        });
+        PrintRow(name, n, n * n / 2 * sizeof(T), vec_ns, std_ns);
+    }
+
+    template <typename T, typename MakeValue>
+    void BenchEraseLoop(const std::string& name, size_t n, MakeValue make) {
+        Vector<T> vec_src;
+        std::vector<T> std_src;
+        for (size_t i = 0; i < n; ++i) {
+            vec_src.PushBack(make(i));
+            std_src.push_back(make(i));
+        }
+        double vec_ns = MeasureNs([&] {
+            Vector<T> v(vec_src);
+            while (v.Size() > 0) {
+                v.Erase(v.begin());
+            }
+        });
+        double std_ns = MeasureNs([&] {
+            std::vector<T> v(std_src);
+            while (!v.empty()) {
+                v.erase(v.begin());
+            }
+        });
+        PrintRow(name, n, n * n / 2 * sizeof(T), vec_ns, std_ns);
+    }
+
+    template <typename T, typename MakeValue>
+    void BenchCopyAssign(const std::string& name, size_t n, MakeValue make) {
+        Vector<T> vec_src;
+        std::vector<T> std_src;
+        for (size_t i = 0; i < n; ++i) {
+            vec_src.PushBack(make(i));
+            std_src.push_back(make(i));
+        }
+        Vector<T> vec_dst;
+        std::vector<T> std_dst;
+        ReserveIn(vec_dst, n);
+        ReserveIn(std_dst, n);
+        double vec_ns = MeasureNs([&] {
+            vec_dst = vec_src;
+        });
+        double std_ns = MeasureNs([&] {
+            std_dst = std_src;
+        });
+        PrintRow(name, n, n * sizeof(T), vec_ns, std_ns);
+    }
+
+}  // namespace
+
+int main() {
+    const size_t LARGE = 1'000'000;
+    const size_t MEDIUM = 100'000;
+    const size_t SMALL = 10'000;
+
+    std::cout << std::left << std::setw(44) << "benchmark"
+        << std::right << std::setw(18) << "Vector"
+        << std::setw(18) << "std::vector"
+        << std::setw(13) << "moved" << '\n';
+
+    auto make_pod = [](size_t i) { return Pod{ static_cast<int64_t>(i), static_cast<int64_t>(i) }; };
+    auto make_move_only = [](size_t i) { return MoveOnly{ static_cast<int>(i) }; };
+    auto make_throwing = [](size_t) { return ThrowingCopy{}; };
+
+    BenchGrowth<Pod>("growth/pod/1M", LARGE, make_pod);
+    BenchGrowth<MoveOnly>("growth/move_only/100k", MEDIUM, make_move_only);
+    BenchGrowth<ThrowingCopy>("growth/throwing_copy/100k", MEDIUM, make_throwing);
+
+    BenchReserveFill<Pod>("reserve_fill/pod/1M", LARGE, make_pod);
+    BenchReserveFill<ThrowingCopy>("reserve_fill/throwing_copy/100k", MEDIUM, make_throwing);
+
+    BenchInsertFront<Pod>("insert_front/pod/10k", SMALL, make_pod);
+    BenchEraseLoop<Pod>("erase_front_loop/pod/10k", SMALL, make_pod);
+
+    BenchCopyAssign<Pod>("copy_assign/pod/1M", LARGE, make_pod);
+    BenchCopyAssign<ThrowingCopy>("copy_assign/throwing_copy/100k", MEDIUM, make_throwing);
+}
@@ -0,0 +1,152 @@
+#pragma once
+#include "vector.h"
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
+// Multi-producer append buffer over RawMemory: producers claim slots in a
+// pre-reserved buffer with one atomic CAS on the size counter and construct
+// in place, so N threads fill ONE buffer and the end-of-window merge copy
+// disappears along with the duplicate per-thread buffers. Appends run under
+// a shared lock; overflow takes the exclusive lock, which drains all
+// in-flight constructions before the buffer is reallocated - the exclusive
+// section is the epoch boundary of the grow protocol.
+//
+// Size()/operator[]/iteration are meant for the consumer after producers
+// quiesce (end of window); calling them concurrently with appends may
+// observe slots that are claimed but still being constructed.
+template <typename T>
+class ConcurrentVector {
+public:
+    /////_CONSTRUCTORS_/////////////////////////////////////
+    ConcurrentVector() = default;
+
+    explicit ConcurrentVector(size_t initial_capacity)
+        :data_(initial_capacity)
+        , capacity_(initial_capacity) {
+    }
+
+    ConcurrentVector(const ConcurrentVector& other) = delete; // atomics and the lock pin the identity
+    ConcurrentVector& operator=(const ConcurrentVector& rhs) = delete;
+
+    ~ConcurrentVector() {
+        std::destroy_n(data_.GetAddress(), claimed_.load());
+    }
+
+    /////_ITERATORS (quiescent use only)_/////////////////////////////////////
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    iterator begin() noexcept {
+        return data_.GetAddress();
+    }
+    iterator end() noexcept {
+        return data_.GetAddress() + claimed_.load();
+    }
+    const_iterator begin() const noexcept {
+        return data_.GetAddress();
+    }
+    const_iterator end() const noexcept {
+        return data_.GetAddress() + claimed_.load();
+    }
+
+    /////_OVERLOADS_/////////////////////////////////////
+    T& operator[](size_t index) noexcept {
+        VECTOR_VERIFY_INDEX(index < claimed_.load());
+        return data_.GetAddress()[index];
+    }
+    const T& operator[](size_t index) const noexcept {
+        return (*const_cast<ConcurrentVector*>(this))[index];
+    }
+
+    /////_METHODS FOR SIZE/CAPACITY_/////////////////////////////////////
+    size_t Size() const noexcept {
+        return claimed_.load();
+    }
+
+    size_t Capacity() const noexcept {
+        return capacity_.load();
+    }
+
+    void Reserve(size_t new_capacity) {
+        Grow(new_capacity);
+    }
+
+    /////_METHODS FOR ELEMENTS MODIFICATION_/////////////////////////////////////
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        for (;;) {
+            std::shared_lock lock(grow_mutex_); // appenders share; grow excludes
+            size_t index = ClaimSlots(1);
+            if (index != kClaimFailed) {
+                T* slot = data_.GetAddress() + index;
+                new (slot) T(std::forward<Args>(args)...);
+                return *slot;
+            }
+            lock.unlock();
+            Grow(capacity_.load() + 1);
+        }
+    }
+
+    void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+    void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    // Claim a whole contiguous range with one CAS and copy a batch into it -
+    // the bulk analogue of AppendRange. Returns the base index of the batch.
+    template <typename InputIt>
+    size_t AppendRange(InputIt first, InputIt last) {
+        size_t count = std::distance(first, last);
+        for (;;) {
+            std::shared_lock lock(grow_mutex_);
+            size_t index = ClaimSlots(count);
+            if (index != kClaimFailed) {
+                std::uninitialized_copy(first, last, data_.GetAddress() + index);
+                return index;
+            }
+            lock.unlock();
+            Grow(capacity_.load() + count);
+        }
+    }
+
+private:
+    static constexpr size_t kClaimFailed = static_cast<size_t>(-1);
+
+    RawMemory<T> data_;
+    std::atomic<size_t> claimed_{ 0 }; // never exceeds capacity_, thanks to the CAS claim
+    std::atomic<size_t> capacity_{ 0 };
+    std::shared_mutex grow_mutex_;
+
+    size_t ClaimSlots(size_t count) noexcept { // CAS instead of fetch-add so a full buffer never overshoots
+        size_t index = claimed_.load();
+        while (index + count <= capacity_.load()) {
+            if (claimed_.compare_exchange_weak(index, index + count)) {
+                return index;
+            }
+        }
+        return kClaimFailed;
+    }
+
+    void Grow(size_t required) {
+        std::unique_lock lock(grow_mutex_); // waits out every in-flight construction
+        if (required <= capacity_.load()) {
+            return; // another thread grew the buffer while we waited
+        }
+        size_t size = claimed_.load(); // all claimed slots are fully constructed here
+        size_t new_capacity = GrowthDoubling::Next(capacity_.load(), required);
+        RawMemory<T> new_data(new_capacity);
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move_n(data_.GetAddress(), size, new_data.GetAddress());
+        }
+        else {
+            std::uninitialized_copy_n(data_.GetAddress(), size, new_data.GetAddress());
+        }
+        std::destroy_n(data_.GetAddress(), size);
+        data_.Swap(new_data);
+        capacity_.store(new_capacity);
+    }
+};
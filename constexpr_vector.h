@@ -0,0 +1,90 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+// Fixed-capacity constexpr companion to Vector for compile-time table
+// generation: CRC tables, sin/cos tables, dispatch maps. Build the table in
+// a constexpr function, bind it to a constexpr variable and the bytes land
+// in .rodata - no startup cost, no runtime relocations.
+//
+// The capacity is a template parameter because real constexpr allocation
+// needs C++20 while this tree builds as C++17; every table we generate has
+// a compile-time-known bound anyway. All MaxElements slots are
+// value-initialized up front (the constexpr-friendly stand-in for placement
+// new), so T must be default-constructible and PushBack assigns into a live
+// slot rather than constructing one.
+template <typename T, size_t MaxElements>
+class ConstexprVector {
+    static_assert(MaxElements > 0, "a table needs at least one slot");
+
+public:
+    /////_CONSTRUCTORS_/////////////////////////////////////
+    constexpr ConstexprVector() = default;
+
+    /////_ITERATORS_/////////////////////////////////////
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr iterator begin() noexcept {
+        return data_;
+    }
+    constexpr iterator end() noexcept {
+        return data_ + size_;
+    }
+    constexpr const_iterator begin() const noexcept {
+        return data_;
+    }
+    constexpr const_iterator end() const noexcept {
+        return data_ + size_;
+    }
+
+    /////_OVERLOADS_/////////////////////////////////////
+    constexpr T& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return data_[index];
+    }
+    constexpr const T& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return data_[index];
+    }
+
+    /////_METHODS FOR SIZE/CAPACITY_/////////////////////////////////////
+    constexpr size_t Size() const noexcept {
+        return size_;
+    }
+
+    constexpr size_t Capacity() const noexcept {
+        return MaxElements;
+    }
+
+    constexpr void Resize(size_t new_size) {
+        assert(new_size <= MaxElements);
+        for (size_t i = new_size; i < size_; ++i) { // shrinking resets the tail to a fresh value
+            data_[i] = T{};
+        }
+        size_ = new_size;
+    }
+
+    /////_METHODS FOR ELEMENTS MODIFICATION_/////////////////////////////////////
+    constexpr void PushBack(const T& value) {
+        assert(size_ < MaxElements);
+        data_[size_++] = value;
+    }
+
+    template <typename... Args>
+    constexpr T& EmplaceBack(Args&&... args) {
+        assert(size_ < MaxElements);
+        data_[size_] = T(std::forward<Args>(args)...);
+        return data_[size_++];
+    }
+
+    constexpr void PopBack() {
+        assert(size_ > 0);
+        data_[--size_] = T{};
+    }
+
+private:
+    T data_[MaxElements]{};
+    size_t size_ = 0;
+};
@@ -0,0 +1,102 @@
+#pragma once
+#include "vector.h"
+
+#include <memory>
+
+// Copy-on-write handle over Vector<T> for read-mostly snapshot workloads.
+// Copying a CowVector (or calling Snapshot()) is O(1): handles share one
+// refcounted Vector. A private deep copy is materialized only when a handle
+// is mutated while others still reference the buffer, so fanning a large
+// vector out to many reader threads costs neither time nor RSS.
+template <typename T>
+class CowVector {
+public:
+    /////_CONSTRUCTORS_/////////////////////////////////////
+    CowVector()
+        :data_(std::make_shared<Vector<T>>()) {
+    }
+
+    explicit CowVector(Vector<T> source)
+        :data_(std::make_shared<Vector<T>>(std::move(source))) {
+    }
+
+    CowVector(const CowVector& other) = default;            // O(1), shares the buffer
+    CowVector& operator=(const CowVector& rhs) = default;   // O(1), shares the buffer
+    CowVector(CowVector&& other) noexcept = default;
+    CowVector& operator=(CowVector&& rhs) noexcept = default;
+
+    // Explicit spelling of the O(1) share for call sites that want to
+    // document taking a read-only snapshot.
+    CowVector Snapshot() const noexcept {
+        return *this;
+    }
+
+    /////_READ ACCESS_/////////////////////////////////////
+    using const_iterator = typename Vector<T>::const_iterator;
+
+    size_t Size() const noexcept {
+        return data_->Size();
+    }
+    size_t Capacity() const noexcept {
+        return data_->Capacity();
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return (*data_)[index];
+    }
+
+    const_iterator begin() const noexcept {
+        return data_->cbegin();
+    }
+    const_iterator end() const noexcept {
+        return data_->cend();
+    }
+
+    bool SharesBufferWith(const CowVector& other) const noexcept {
+        return data_ == other.data_;
+    }
+
+    long UseCount() const noexcept {
+        return data_.use_count();
+    }
+
+    /////_MUTATION (detaches from shared buffer)_/////////////////////////////////////
+    T& Mutable(size_t index) {
+        Detach();
+        return (*data_)[index];
+    }
+
+    void PushBack(const T& value) {
+        Detach();
+        data_->PushBack(value);
+    }
+    void PushBack(T&& value) {
+        Detach();
+        data_->PushBack(std::move(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        Detach();
+        return data_->EmplaceBack(std::forward<Args>(args)...);
+    }
+
+    void PopBack() {
+        Detach();
+        data_->PopBack();
+    }
+
+    void Resize(size_t new_size) {
+        Detach();
+        data_->Resize(new_size);
+    }
+
+private:
+    std::shared_ptr<Vector<T>> data_;
+
+    void Detach() { // first mutation while shared deep-copies into a private buffer
+        if (data_.use_count() > 1) {
+            data_ = std::make_shared<Vector<T>>(*data_);
+        }
+    }
+};
@@ -0,0 +1,117 @@
+#pragma once
+#include "vector.h"
+
+// Fixed-size array with deferred element construction, for sparse per-shard
+// stats where only a few percent of slots are ever touched. The constructor
+// allocates raw capacity plus a compact bitmap (one bit per slot) and
+// constructs NOTHING; an element is value-constructed on first non-const
+// access and the destructor visits only the bitmap's set bits, so a 10M-slot
+// shard pays construction/destruction for the slots it actually used and
+// untouched pages stay unmapped until first write.
+template <typename T>
+class LazyVector {
+    static_assert(std::is_default_constructible_v<T>, "first touch value-constructs the slot");
+
+public:
+    /////_CONSTRUCTORS_/////////////////////////////////////
+    LazyVector() = default;
+
+    explicit LazyVector(size_t size)
+        :data_(size)
+        , bitmap_(WordsFor(size))
+        , size_(size) {
+        std::memset(bitmap_.GetAddress(), 0, WordsFor(size) * sizeof(uint64_t));
+    }
+
+    LazyVector(const LazyVector& other) = delete; // copying would defeat the laziness being measured
+    LazyVector& operator=(const LazyVector& rhs) = delete;
+
+    LazyVector(LazyVector&& other) noexcept {
+        Swap(other);
+    }
+    LazyVector& operator=(LazyVector&& rhs) noexcept {
+        Swap(rhs);
+        return *this;
+    }
+
+    ~LazyVector() {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            ForEachInitialized([](size_t /*index*/, T& value) {
+                std::destroy_at(&value);
+            });
+        }
+    }
+
+    /////_OVERLOADS_/////////////////////////////////////
+    T& operator[](size_t index) { // first non-const access constructs the slot
+        VECTOR_VERIFY_INDEX(index < size_);
+        uint64_t& word = bitmap_[index / 64];
+        uint64_t bit = uint64_t{ 1 } << (index % 64);
+        if ((word & bit) == 0) {
+            new (data_.GetAddress() + index) T();
+            word |= bit;
+            ++initialized_;
+        }
+        return data_[index];
+    }
+
+    const T& operator[](size_t index) const noexcept { // const access never constructs
+        VECTOR_VERIFY_INDEX(index < size_);
+        assert(IsInitialized(index));
+        return data_[index];
+    }
+
+    /////_METHODS FOR SIZE/CAPACITY_/////////////////////////////////////
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t InitializedCount() const noexcept {
+        return initialized_;
+    }
+
+    bool IsInitialized(size_t index) const noexcept {
+        assert(index < size_);
+        return (bitmap_[index / 64] & (uint64_t{ 1 } << (index % 64))) != 0;
+    }
+
+    /////_TRAVERSAL_/////////////////////////////////////
+    // The slot if it was ever touched, nullptr otherwise - read-only scans
+    // over sparse shards should use this instead of forcing construction.
+    const T* Peek(size_t index) const noexcept {
+        assert(index < size_);
+        return IsInitialized(index) ? data_.GetAddress() + index : nullptr;
+    }
+
+    // Visit only constructed slots; whole-zero bitmap words are skipped, so
+    // the cost scales with touched slots, not with Size().
+    template <typename Fn>
+    void ForEachInitialized(Fn fn) {
+        for (size_t w = 0; w < WordsFor(size_); ++w) {
+            uint64_t word = bitmap_[w];
+            while (word != 0) {
+                size_t index = w * 64 + static_cast<size_t>(__builtin_ctzll(word));
+                fn(index, data_[index]);
+                word &= word - 1; // clear the lowest set bit
+            }
+        }
+    }
+
+    /////_OTHER_//////////////////////////////////////////////////////////////////
+    void Swap(LazyVector& other) noexcept {
+        data_.Swap(other.data_);
+        bitmap_.Swap(other.bitmap_);
+        std::swap(size_, other.size_);
+        std::swap(initialized_, other.initialized_);
+    }
+
+private:
+    RawMemory<T> data_;
+    RawMemory<uint64_t> bitmap_; // bit per slot, 1 = constructed
+    size_t size_ = 0;
+    size_t initialized_ = 0;
+
+    static size_t WordsFor(size_t size) noexcept {
+        return (size + 63) / 64;
+    }
+};
@@ -1,6 +1,17 @@
 ﻿#include "vector.h"
+#include "concurrent_vector.h"
+#include "constexpr_vector.h"
+#include "cow_vector.h"
+#include "lazy_vector.h"
+#include "mapped_vector.h"
+#include "soa_vector.h"
+#include "sorted_vector.h"
+#include "spill_vector.h"
+#include "stable_vector.h"
 
+#include <atomic>
 #include <iostream>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 
@@ -89,13 +100,14 @@ namespace {
         int id = 0;
         std::string name;
 
-        static inline int default_construction_throw_countdown = 0;
-        static inline int num_default_constructed = 0;
-        static inline int num_constructed_with_id = 0;
-        static inline int num_constructed_with_id_and_name = 0;
-        static inline int num_copied = 0;
-        static inline int num_moved = 0;
-        static inline int num_destroyed = 0;
+        // Atomic so that parallel construction/destruction tests can share them
+        static inline std::atomic<int> default_construction_throw_countdown = 0;
+        static inline std::atomic<int> num_default_constructed = 0;
+        static inline std::atomic<int> num_constructed_with_id = 0;
+        static inline std::atomic<int> num_constructed_with_id_and_name = 0;
+        static inline std::atomic<int> num_copied = 0;
+        static inline std::atomic<int> num_moved = 0;
+        static inline std::atomic<int> num_destroyed = 0;
     };
 
 }  // namespace
@@ -385,6 +397,1124 @@ void Test5() {
     }
 }
 
+void TestTrivialInsert() { // covers the memmove shift path for trivially copyable types
+    Vector<int> v;
+    v.Reserve(16);
+    for (int i = 0; i < 10; ++i) {
+        v.PushBack(i);
+    }
+    v.Insert(v.begin() + 3, 100);
+    assert(v.Size() == 11);
+    assert(v[2] == 2);
+    assert(v[3] == 100);
+    for (int i = 4; i < 11; ++i) {
+        assert(v[i] == i - 1);
+    }
+}
+
+void TestArenaAllocation() {
+    alignas(64) static unsigned char arena_storage[1 << 16];
+    ArenaResource arena(arena_storage, sizeof(arena_storage));
+    {
+        ArenaAllocation<int> alloc(arena);
+        Vector<int, 0, ArenaAllocation<int>> v(alloc);
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Size() == 100);
+        assert(v[99] == 99);
+        assert(arena.Used() >= 100 * sizeof(int));
+        // buffer must come from the arena region
+        const unsigned char* elems = reinterpret_cast<const unsigned char*>(v.begin());
+        assert(elems >= arena_storage && elems < arena_storage + sizeof(arena_storage));
+
+        Vector<int, 0, ArenaAllocation<int>> v_copy(v); // copy keeps the same arena
+        assert(v_copy.Size() == 100);
+        const unsigned char* copy_elems = reinterpret_cast<const unsigned char*>(v_copy.begin());
+        assert(copy_elems >= arena_storage && copy_elems < arena_storage + sizeof(arena_storage));
+    }
+    arena.Release();
+    assert(arena.Used() == 0);
+}
+
+void TestAlignedAllocation() {
+    {
+        AlignedVector<float> v;
+        v.Reserve(100);
+        assert(reinterpret_cast<uintptr_t>(v.begin()) % 64 == 0);
+        for (int i = 0; i < 200; ++i) { // growth must keep the alignment
+            v.PushBack(static_cast<float>(i));
+        }
+        assert(reinterpret_cast<uintptr_t>(v.begin()) % 64 == 0);
+        assert(v[199] == 199.f);
+    }
+    {
+        AlignedVector<double, 32> v(10);
+        assert(reinterpret_cast<uintptr_t>(v.begin()) % 32 == 0);
+    }
+}
+
+void TestAppendRange() {
+    const size_t SIZE = 1000;
+    {
+        Obj::ResetCounters();
+        Vector<Obj> src(SIZE);
+        Vector<Obj> v;
+        v.AppendRange(src.begin(), src.end());
+        assert(v.Size() == SIZE);
+        assert(v.Capacity() == SIZE); // exactly one allocation for the whole batch
+        assert(Obj::num_copied == SIZE);
+        assert(Obj::num_moved == 0); // nothing was reallocated mid-load
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        Vector<int> v;
+        v.PushBack(-1);
+        int batch[] = { 0, 1, 2, 3, 4 };
+        v.AppendRange(std::begin(batch), std::end(batch));
+        assert(v.Size() == 6);
+        assert(v[0] == -1);
+        for (int i = 0; i < 5; ++i) {
+            assert(v[i + 1] == i);
+        }
+        v.AppendN(3, 7);
+        assert(v.Size() == 9);
+        assert(v[6] == 7 && v[7] == 7 && v[8] == 7);
+    }
+}
+
+void TestInsertRange() {
+    {
+        Vector<int> v; // memmove path: one shift of the tail for the whole batch
+        for (int i = 0; i < 8; ++i) {
+            v.PushBack(i);
+        }
+        int batch[] = { 100, 101, 102 };
+        auto it = v.InsertRange(v.cbegin() + 3, std::begin(batch), std::end(batch));
+        assert(*it == 100);
+        assert(v.Size() == 11);
+        assert(v[2] == 2 && v[3] == 100 && v[5] == 102 && v[6] == 3 && v[10] == 7);
+    }
+    {
+        Vector<std::string> v; // generic path, batch narrower than the tail
+        for (int i = 0; i < 6; ++i) {
+            v.PushBack("old" + std::to_string(i));
+        }
+        v.Reserve(16);
+        std::string batch[] = { "a", "b" };
+        v.InsertRange(v.cbegin() + 1, std::begin(batch), std::end(batch));
+        assert(v.Size() == 8);
+        assert(v[0] == "old0" && v[1] == "a" && v[2] == "b" && v[3] == "old1" && v[7] == "old5");
+    }
+    {
+        Vector<std::string> v; // generic path, batch wider than the tail
+        v.PushBack("head");
+        v.PushBack("tail");
+        v.Reserve(8);
+        std::string batch[] = { "a", "b", "c", "d" };
+        v.InsertRange(v.cbegin() + 1, std::begin(batch), std::end(batch));
+        assert(v.Size() == 6);
+        assert(v[0] == "head" && v[1] == "a" && v[4] == "d" && v[5] == "tail");
+    }
+    {
+        Obj::ResetCounters();
+        const size_t SIZE = 64;
+        Vector<Obj> v(SIZE);
+        Vector<Obj> batch(SIZE / 4);
+        size_t old_capacity = v.Capacity();
+        v.InsertRange(v.cbegin() + SIZE / 2, batch.begin(), batch.end()); // forces one reallocation
+        assert(v.Size() == SIZE + SIZE / 4);
+        assert(v.Capacity() > old_capacity);
+        assert(Obj::num_copied == SIZE / 4); // the batch itself; old elements were moved, not copied
+        assert(Obj::GetAliveObjectCount() == static_cast<int>(v.Size() + batch.Size()));
+        auto empty_it = v.InsertRange(v.cbegin(), batch.begin(), batch.begin()); // empty range is a no-op
+        assert(empty_it == v.begin());
+        assert(v.Size() == SIZE + SIZE / 4);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void TestCheckedAccess() {
+    Vector<int> v;
+    for (int i = 0; i < 5; ++i) {
+        v.PushBack(i);
+    }
+    const Vector<int>& cv = v;
+    assert(v.At(0) == 0);
+    assert(cv.At(4) == 4);
+    assert(&v.At(2) == &v[2]);
+    v.At(1) = 42;
+    assert(cv[1] == 42);
+    try {
+        v.At(5);
+        assert(false && "Exception is expected");
+    }
+    catch (const std::out_of_range&) {
+    }
+    try {
+        cv.At(100);
+        assert(false && "Exception is expected");
+    }
+    catch (const std::out_of_range&) {
+    }
+}
+
+void TestMoveAssignAndClear() {
+    const size_t SIZE = 100;
+    {
+        Obj::ResetCounters();
+        Vector<Obj> dst(SIZE);
+        Vector<Obj> src(SIZE / 2);
+        dst = std::move(src);
+        assert(dst.Size() == SIZE / 2);
+        assert(Obj::GetAliveObjectCount() == SIZE / 2); // dst's old elements died right away
+        assert(src.Size() == 0); // moved-from vector no longer parks the old buffer
+        assert(src.Capacity() == 0);
+        assert(Obj::num_moved == 0 && Obj::num_copied == 0); // pure buffer steal
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(SIZE);
+        size_t capacity = v.Capacity();
+        v.Clear();
+        assert(v.Size() == 0);
+        assert(v.Capacity() == capacity); // buffer kept for reuse
+        assert(Obj::GetAliveObjectCount() == 0);
+        v.PushBack(Obj{});
+        assert(v.Capacity() == capacity); // no reallocation after Clear
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void TestTelemetry() { // does something only in -DVECTOR_TELEMETRY builds
+#if defined(VECTOR_TELEMETRY)
+    struct Probe { // unique element type, so no other test touches these counters
+        long payload;
+    };
+    VectorTelemetryStats& stats = VectorTelemetryFor<Probe>();
+    assert(stats.reallocations == 0);
+    Vector<Probe> v;
+    for (long i = 0; i < 16; ++i) {
+        v.PushBack(Probe{ i });
+    }
+    assert(stats.reallocations == 5); // capacities 1, 2, 4, 8, 16
+    assert(stats.peak_capacity == 16);
+    assert(stats.bytes_transferred == 15 * sizeof(Probe)); // 1 + 2 + 4 + 8 elements re-homed
+    assert(stats.element_moves == 15); // trivially copyable - memcpy transfers count as moves
+    assert(stats.element_copies == 0);
+    std::ostringstream out;
+    DumpVectorTelemetry(out);
+    assert(out.str().find("reallocations=5") != std::string::npos);
+#endif
+}
+
+namespace constexpr_test {
+
+    constexpr uint32_t Crc32ForByte(uint32_t r) {
+        for (int i = 0; i < 8; ++i) {
+            r = (r & 1) != 0 ? 0xEDB88320u ^ (r >> 1) : r >> 1;
+        }
+        return r;
+    }
+
+    constexpr ConstexprVector<uint32_t, 256> MakeCrcTable() {
+        ConstexprVector<uint32_t, 256> table;
+        for (uint32_t i = 0; i < 256; ++i) {
+            table.PushBack(Crc32ForByte(i));
+        }
+        return table;
+    }
+
+    constexpr auto kCrcTable = MakeCrcTable(); // baked into the binary
+    static_assert(kCrcTable.Size() == 256);
+    static_assert(kCrcTable.Capacity() == 256);
+    static_assert(kCrcTable[0] == 0);
+    static_assert(kCrcTable[1] == 0x77073096u); // well-known CRC-32 constants
+    static_assert(kCrcTable[255] == 0x2D02EF8Du);
+
+}  // namespace constexpr_test
+
+void TestConstexprVector() {
+    // The interesting checks ran at compile time (static_asserts above);
+    // here we only exercise the same container at runtime.
+    ConstexprVector<int, 8> v;
+    for (int i = 0; i < 5; ++i) {
+        v.EmplaceBack(i * i);
+    }
+    assert(v.Size() == 5);
+    assert(v[4] == 16);
+    v.PopBack();
+    v.Resize(2);
+    assert(v.Size() == 2);
+    assert(v[0] == 0 && v[1] == 1);
+    int sum = 0;
+    for (int x : v) {
+        sum += x;
+    }
+    assert(sum == 1);
+    assert(constexpr_test::kCrcTable[1] == 0x77073096u);
+}
+
+void TestResizeForOverwrite() {
+    const size_t SIZE = 1 << 16;
+    {
+        Vector<char> v;
+        v.ResizeForOverwrite(SIZE); // no zero-fill, contents are indeterminate
+        assert(v.Size() == SIZE);
+        assert(v.Capacity() == SIZE);
+        std::memset(v.begin(), 'x', SIZE); // external fill, like read()
+        assert(v[0] == 'x' && v[SIZE - 1] == 'x');
+
+        v.ResizeForOverwrite(SIZE / 2); // shrink just drops the tail
+        assert(v.Size() == SIZE / 2);
+        assert(v.Capacity() == SIZE);
+    }
+    {
+        Vector<int> v;
+        v.Reserve(100);
+        for (int i = 0; i < 100; ++i) {
+            v.begin()[i] = i; // fill raw capacity externally
+        }
+        v.SetSizeUnsafe(100);
+        assert(v.Size() == 100);
+        assert(v[99] == 99);
+    }
+}
+
+void TestEraseOperations() {
+    {
+        Vector<int> v;
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(i);
+        }
+        auto it = v.Erase(v.begin() + 2, v.begin() + 5); // remove 2, 3, 4
+        assert(v.Size() == 7);
+        assert(*it == 5);
+        int expected[] = { 0, 1, 5, 6, 7, 8, 9 };
+        for (size_t i = 0; i < v.Size(); ++i) {
+            assert(v[i] == expected[i]);
+        }
+        assert(v.Erase(v.begin(), v.begin()) == v.begin()); // empty range is a no-op
+        assert(v.Size() == 7);
+    }
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        for (int i = 0; i < 5; ++i) {
+            v.EmplaceBack(i);
+        }
+        auto it = v.EraseUnordered(v.begin() + 1); // last element replaces index 1
+        assert(v.Size() == 4);
+        assert(it == v.begin() + 1);
+        assert(v[1].id == 4);
+        v.EraseUnordered(v.begin() + 3); // erasing the last element just pops
+        assert(v.Size() == 3);
+        assert(Obj::GetAliveObjectCount() == 3);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void TestShrinkToFit() {
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        for (int i = 0; i < 100; ++i) {
+            v.EmplaceBack(i);
+        }
+        assert(v.Capacity() == 128);
+        v.ShrinkToFit();
+        assert(v.Capacity() == 100);
+        assert(v.Size() == 100);
+        assert(v[99].id == 99);
+        v.ShrinkToFit(); // already tight - no-op
+        assert(v.Capacity() == 100);
+
+        v.Reset();
+        assert(v.Size() == 0);
+        assert(v.Capacity() == 0);
+        assert(Obj::GetAliveObjectCount() == 0);
+        v.PushBack(Obj{ 1 }); // vector stays usable after Reset
+        assert(v.Size() == 1);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        Vector<int, 8> v;
+        for (int i = 0; i < 20; ++i) {
+            v.PushBack(i);
+        }
+        v.Erase(v.begin() + 4, v.end());
+        v.ShrinkToFit(); // fits inline again - heap buffer is released
+        assert(v.Size() == 4);
+        assert(v.Capacity() == 8);
+        const char* obj_begin = reinterpret_cast<const char*>(&v);
+        const char* elems = reinterpret_cast<const char*>(v.begin());
+        assert(elems >= obj_begin && elems < obj_begin + sizeof(v));
+        for (int i = 0; i < 4; ++i) {
+            assert(v[i] == i);
+        }
+    }
+}
+
+void TestGrowthPolicies() {
+    {
+        Vector<int, 0, NewDeleteAllocation<int>, Growth3By2> v;
+        v.PushBack(0);
+        assert(v.Capacity() == 1);
+        v.PushBack(1);
+        assert(v.Capacity() == 2); // 1 + 1/2 + 1
+        v.PushBack(2);
+        assert(v.Capacity() == 4); // 2 + 1 + 1
+        v.PushBack(3);
+        v.PushBack(4);
+        assert(v.Capacity() == 7); // 4 + 2 + 1
+        for (int i = 0; i < 5; ++i) {
+            assert(v[i] == i);
+        }
+    }
+    {
+        Vector<int, 0, NewDeleteAllocation<int>, GrowthChunked<8>> v;
+        for (int i = 0; i < 8; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Capacity() == 8); // doubling up to the chunk size
+        v.PushBack(8);
+        assert(v.Capacity() == 16); // then additive chunks, no 2x spike
+        for (int i = 9; i < 17; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Capacity() == 24);
+        assert(v[16] == 16);
+    }
+}
+
+namespace guarantee_test {
+
+    struct ThrowingMove { // move ctor is not noexcept, so the strong guarantee must copy on reallocation
+        static inline int num_copied = 0;
+        static inline int num_moved = 0;
+
+        ThrowingMove() = default;
+        ThrowingMove(const ThrowingMove& /*other*/) {
+            ++num_copied;
+        }
+        ThrowingMove(ThrowingMove&& /*other*/) {
+            ++num_moved;
+        }
+        ThrowingMove& operator=(const ThrowingMove& rhs) = default;
+        ThrowingMove& operator=(ThrowingMove&& rhs) = default;
+
+        static void ResetCounters() {
+            num_copied = 0;
+            num_moved = 0;
+        }
+    };
+
+}  // namespace guarantee_test
+
+void TestGuaranteePolicy() {
+    using guarantee_test::ThrowingMove;
+    const int SIZE = 16;
+    {
+        ThrowingMove::ResetCounters();
+        Vector<ThrowingMove> v; // default GuaranteeStrong: reallocation falls back to copies
+        for (int i = 0; i < SIZE; ++i) {
+            v.PushBack(ThrowingMove{});
+        }
+        assert(ThrowingMove::num_moved == SIZE); // one move per PushBack of the rvalue
+        assert(ThrowingMove::num_copied == SIZE - 1); // 1 + 2 + 4 + 8 elements copied across reallocations
+    }
+    {
+        ThrowingMove::ResetCounters();
+        Vector<ThrowingMove, 0, NewDeleteAllocation<ThrowingMove>, GrowthDoubling, GuaranteeBasic> v;
+        for (int i = 0; i < SIZE; ++i) {
+            v.PushBack(ThrowingMove{});
+        }
+        assert(ThrowingMove::num_copied == 0); // reallocation moves despite the throwing move ctor
+        assert(ThrowingMove::num_moved == SIZE + SIZE - 1);
+    }
+}
+
+void TestParallelResize() {
+    const size_t SIZE = 100'000;
+    const size_t THREADS = 4;
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        v.ResizeParallel(SIZE, THREADS);
+        assert(v.Size() == SIZE);
+        assert(Obj::GetAliveObjectCount() == static_cast<int>(SIZE));
+        assert(Obj::num_default_constructed == static_cast<int>(SIZE));
+
+        v.ResizeParallel(SIZE / 4, THREADS); // parallel shrink destroys the tail
+        assert(v.Size() == SIZE / 4);
+        assert(Obj::GetAliveObjectCount() == static_cast<int>(SIZE / 4));
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        Obj::default_construction_throw_countdown = SIZE / 2;
+        try {
+            v.ResizeParallel(SIZE, THREADS);
+            assert(false && "Exception is expected");
+        }
+        catch (const std::runtime_error&) {
+        }
+        assert(v.Size() == 0); // size unchanged, every partition rolled back
+        assert(Obj::GetAliveObjectCount() == 0);
+        Obj::default_construction_throw_countdown = 0;
+    }
+}
+
+void TestCowVector() {
+    const size_t SIZE = 1000;
+    {
+        Obj::ResetCounters();
+        Vector<Obj> source(SIZE);
+        source[10].id = 42;
+        CowVector<Obj> v(std::move(source));
+
+        auto snapshot = v.Snapshot(); // O(1), no element copies
+        assert(snapshot.SharesBufferWith(v));
+        assert(v.UseCount() == 2);
+        assert(Obj::num_copied == 0);
+        assert(snapshot[10].id == 42);
+        assert(snapshot.begin() == v.begin()); // literally the same buffer
+
+        v.Mutable(10).id = 7; // first write detaches v from the snapshot
+        assert(!snapshot.SharesBufferWith(v));
+        assert(Obj::num_copied == SIZE);
+        assert(v[10].id == 7);
+        assert(snapshot[10].id == 42); // reader is unaffected
+
+        v.PushBack(Obj{ 1 }); // already private - no further copies, growth moves
+        assert(Obj::num_copied == SIZE);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        CowVector<int> v;
+        v.PushBack(1); // sole owner mutates in place
+        v.PushBack(2);
+        assert(v.Size() == 2);
+        assert(v.UseCount() == 1);
+        CowVector<int> copy = v; // copy-assign of handles is O(1) too
+        assert(copy.SharesBufferWith(v));
+    }
+}
+
+namespace {
+    std::atomic<int> num_external_frees = 0;
+
+    void CountingFree(int* buf, size_t /*capacity*/) {
+        ++num_external_frees;
+        std::free(buf);
+    }
+}  // namespace
+
+void TestAdoptRelease() {
+    num_external_frees = 0;
+    {
+        int* raw = static_cast<int*>(std::malloc(100 * sizeof(int)));
+        for (int i = 0; i < 50; ++i) {
+            raw[i] = i;
+        }
+        auto v = AdoptedVector<int>::Adopt(raw, 50, 100, CountingFree);
+        assert(v.Size() == 50);
+        assert(v.Capacity() == 100);
+        assert(v.begin() == raw); // zero-copy: same buffer
+        assert(v[49] == 49);
+        v.PushBack(50); // fits in adopted capacity, no reallocation
+        assert(v.begin() == raw);
+    }
+    assert(num_external_frees == 1); // destructor went through the deleter
+    {
+        int* raw = static_cast<int*>(std::malloc(4 * sizeof(int)));
+        for (int i = 0; i < 4; ++i) {
+            raw[i] = i;
+        }
+        auto v = AdoptedVector<int>::Adopt(raw, 4, 4, CountingFree);
+        v.PushBack(4); // overflows adopted capacity - moves to a heap buffer
+        assert(num_external_frees == 2); // adopted buffer freed by the deleter
+        assert(v.Size() == 5);
+        assert(v[0] == 0 && v[4] == 4);
+    }
+    assert(num_external_frees == 2); // heap buffer was not routed to the deleter
+    {
+        Vector<int> v;
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(i);
+        }
+        int* released = v.Release(); // ownership moves out, vector is neutered
+        assert(v.Size() == 0);
+        assert(v.Capacity() == 0);
+        v.PushBack(42); // still usable afterwards
+        assert(v[0] == 42);
+        assert(released[9] == 9);
+        operator delete(released); // default policy allocated with operator new
+    }
+}
+
+void TestMappedVector() {
+    struct FixedRecord {
+        int64_t key;
+        double value;
+    };
+    const char* PATH = "test_mapped_vector.bin";
+    {
+        Vector<FixedRecord> v;
+        for (int i = 0; i < 1000; ++i) {
+            v.PushBack(FixedRecord{ i, i * 0.5 });
+        }
+        SaveMapped(v, PATH);
+    }
+    {
+        auto v = LoadMapped<FixedRecord>(PATH);
+        assert(v.Size() == 1000);
+        assert(v[0].key == 0);
+        assert(v[999].key == 999);
+        assert(v[999].value == 999 * 0.5);
+
+        v[0].key = -1; // private mapping: writes don't reach the file
+        assert(v[0].key == -1);
+    }
+    {
+        auto v = LoadMapped<FixedRecord>(PATH);
+        assert(v[0].key == 0); // file contents untouched by the previous run
+        v.PushBack(FixedRecord{ 1000, 0.0 }); // growth unmaps and moves to heap
+        assert(v.Size() == 1001);
+        assert(v[500].key == 500);
+    }
+    {
+        bool thrown = false;
+        try {
+            LoadMapped<FixedRecord>("no_such_file.bin");
+        }
+        catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    std::remove(PATH);
+}
+
+void TestSoaVector() {
+    {
+        SoaVector<float, float, int> particles; // x, y, id
+        for (int i = 0; i < 1000; ++i) {
+            particles.EmplaceBack(i * 1.0f, i * 2.0f, i);
+        }
+        assert(particles.Size() == 1000);
+
+        const float* xs = particles.FieldData<0>(); // contiguous per-field array
+        float sum = 0.f;
+        for (size_t i = 0; i < particles.Size(); ++i) {
+            sum += xs[i];
+        }
+        assert(sum == 999.f * 1000.f / 2.f);
+
+        auto record = particles[10]; // proxy over all fields of one record
+        assert(std::get<0>(record) == 10.f);
+        assert(std::get<1>(record) == 20.f);
+        assert(std::get<2>(record) == 10);
+        std::get<2>(record) = -1; // writes through to the field array
+        assert(particles.Field<2>(10) == -1);
+
+        particles.PopBack();
+        assert(particles.Size() == 999);
+    }
+    {
+        SoaVector<int, std::string> rows; // non-trivial field exercises transfer/destroy
+        rows.Reserve(4);
+        for (int i = 0; i < 100; ++i) {
+            rows.EmplaceBack(i, std::string(40, 'a' + i % 26));
+        }
+        assert(rows.Size() == 100);
+        assert(rows.Field<1>(25) == std::string(40, 'z'));
+
+        SoaVector<int, std::string> copy(rows);
+        assert(copy.Size() == 100);
+        assert(copy.Field<0>(99) == 99);
+        copy.Field<1>(0) = "changed";
+        assert(rows.Field<1>(0) != "changed"); // deep copy
+
+        SoaVector<int, std::string> moved(std::move(rows));
+        assert(moved.Size() == 100);
+        assert(moved.Field<1>(25) == std::string(40, 'z'));
+    }
+}
+
+void Test6() {
+    const int MAGIC = 42;
+    {
+        Vector<int, 8> v;
+        assert(v.Size() == 0);
+        assert(v.Capacity() == 8); // inline buffer is available from the start
+        for (int i = 0; i < 8; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Capacity() == 8);
+        // elements must live inside the vector object itself
+        const char* obj_begin = reinterpret_cast<const char*>(&v);
+        const char* obj_end = obj_begin + sizeof(v);
+        const char* elems = reinterpret_cast<const char*>(v.begin());
+        assert(elems >= obj_begin && elems < obj_end);
+
+        v.PushBack(8); // overflow of inline buffer moves data to heap
+        assert(v.Capacity() == 16);
+        assert(v.Size() == 9);
+        for (int i = 0; i < 9; ++i) {
+            assert(v[i] == i);
+        }
+        const char* heap_elems = reinterpret_cast<const char*>(v.begin());
+        assert(heap_elems < obj_begin || heap_elems >= obj_end);
+    }
+    {
+        Obj::ResetCounters();
+        Vector<Obj, 4> v;
+        v.EmplaceBack(MAGIC);
+        v.EmplaceBack(MAGIC + 1);
+        Vector<Obj, 4> v_moved(std::move(v));
+        assert(v_moved.Size() == 2);
+        assert(v_moved[0].id == MAGIC);
+        assert(v_moved[1].id == MAGIC + 1);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        Obj::ResetCounters();
+        Vector<Obj, 4> v_small;
+        v_small.EmplaceBack(1);
+        Vector<Obj, 4> v_large;
+        for (int i = 0; i < 10; ++i) {
+            v_large.EmplaceBack(i);
+        }
+        v_small.Swap(v_large); // mixed inline/heap swap
+        assert(v_small.Size() == 10);
+        assert(v_large.Size() == 1);
+        assert(v_small[9].id == 9);
+        assert(v_large[0].id == 1);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void TestStableVector() {
+    const size_t SIZE = 1000;
+    {
+        StableVector<int, 16> v;
+        v.PushBack(0);
+        int* first = &v[0];
+        for (int i = 1; i < static_cast<int>(SIZE); ++i) {
+            v.PushBack(i);
+        }
+        assert(&v[0] == first); // no element ever moved across growth
+        assert(v.Size() == SIZE);
+        assert(v.Capacity() % 16 == 0 && v.Capacity() >= SIZE);
+        int* middle = &v[SIZE / 2];
+        for (int i = 0; i < static_cast<int>(SIZE); ++i) {
+            v.PushBack(i);
+        }
+        assert(&v[SIZE / 2] == middle);
+        long sum = 0;
+        for (int x : v) {
+            sum += x;
+        }
+        assert(sum == 2 * (SIZE - 1) * SIZE / 2);
+    }
+    {
+        Obj::ResetCounters();
+        StableVector<Obj, 8> v;
+        for (int i = 0; i < 100; ++i) {
+            v.EmplaceBack(i);
+        }
+        assert(Obj::num_moved == 0 && Obj::num_copied == 0); // growth never touches elements
+        assert(Obj::GetAliveObjectCount() == 100);
+        v.PopBack();
+        assert(Obj::GetAliveObjectCount() == 99);
+
+        StableVector<Obj, 8> v_copy(v);
+        assert(v_copy.Size() == 99);
+        assert(v_copy[42].id == 42);
+        assert(Obj::GetAliveObjectCount() == 2 * 99);
+
+        StableVector<Obj, 8> v_moved(std::move(v));
+        assert(v_moved.Size() == 99);
+        assert(Obj::GetAliveObjectCount() == 2 * 99); // move steals chunks, no new objects
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void TestConcurrentVector() {
+    const size_t THREADS = 8;
+    const size_t PER_THREAD = 10'000;
+    {
+        ConcurrentVector<size_t> v(16); // tiny initial capacity - forces growth under contention
+        {
+            Vector<std::thread> producers;
+            producers.Reserve(THREADS);
+            for (size_t t = 0; t < THREADS; ++t) {
+                producers.EmplaceBack([&v, t] {
+                    for (size_t i = 0; i < PER_THREAD; ++i) {
+                        v.EmplaceBack(t * PER_THREAD + i);
+                    }
+                });
+            }
+            for (size_t t = 0; t < THREADS; ++t) {
+                producers[t].join();
+            }
+        }
+        assert(v.Size() == THREADS * PER_THREAD);
+        Vector<char> seen(THREADS * PER_THREAD);
+        for (size_t value : v) {
+            assert(value < THREADS * PER_THREAD);
+            assert(seen[value] == 0); // each claimed slot was written exactly once
+            seen[value] = 1;
+        }
+    }
+    {
+        ConcurrentVector<int> v;
+        int batch[] = { 1, 2, 3, 4, 5 };
+        size_t base = v.AppendRange(std::begin(batch), std::end(batch));
+        assert(base == 0);
+        v.AppendRange(std::begin(batch), std::end(batch));
+        assert(v.Size() == 10);
+        assert(v[0] == 1 && v[4] == 5 && v[5] == 1 && v[9] == 5);
+    }
+    {
+        Obj::ResetCounters();
+        {
+            ConcurrentVector<Obj> v(4);
+            for (int i = 0; i < 100; ++i) {
+                v.EmplaceBack(i);
+            }
+            assert(Obj::GetAliveObjectCount() == 100);
+            assert(v[42].id == 42);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+void TestSpillVector() {
+    const size_t WINDOW = 64;
+    const size_t SIZE = 1000; // 15 spilled segments plus a partial window
+    {
+        SpillVector<size_t> v(WINDOW);
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Size() == SIZE);
+        assert(v.SpilledElements() == (SIZE / WINDOW) * WINDOW);
+        size_t expected = 0;
+        for (size_t value : v) { // sequential scan crosses every segment boundary
+            assert(value == expected);
+            ++expected;
+        }
+        assert(expected == SIZE);
+        assert(v[0] == 0); // random access across cold segments
+        assert(v[WINDOW - 1] == WINDOW - 1);
+        assert(v[WINDOW] == WINDOW);
+        assert(v[SIZE - 1] == SIZE - 1);
+    }
+    {
+        SpillVector<int> v(WINDOW); // nothing spilled - pure window iteration
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(i * 2);
+        }
+        assert(v.SpilledElements() == 0);
+        int sum = 0;
+        for (int value : v) {
+            sum += value;
+        }
+        assert(sum == 90);
+    }
+}
+
+void TestFindAndCompare() {
+    {
+        Vector<int32_t> v; // 35 elements - exercises the SIMD body and the scalar tail
+        for (int32_t i = 0; i < 35; ++i) {
+            v.PushBack(i * 3);
+        }
+        v.PushBack(42);
+        v.PushBack(42); // duplicate - Find must report the first one
+        assert(v.Find(0) == v.begin());
+        assert(v.Find(42) == v.begin() + 14); // 14 * 3 == 42 comes before the appended ones
+        assert(v.Find(102) == v.begin() + 34);
+        assert(v.Find(-7) == v.end());
+        assert(v.Contains(99));
+        assert(!v.Contains(100));
+        *v.Find(102) = 7; // non-const Find yields a mutable iterator
+        assert(v[34] == 7);
+    }
+    {
+        Vector<uint64_t> v;
+        for (uint64_t i = 0; i < 13; ++i) {
+            v.PushBack(i * i);
+        }
+        assert(v.Find(144) == v.begin() + 12);
+        assert(v.Find(5) == v.end());
+        assert(v.Contains(0));
+    }
+    {
+        Vector<std::string> v; // scalar path for non-integral element types
+        v.PushBack("alpha");
+        v.PushBack("beta");
+        assert(v.Find("beta") == v.begin() + 1);
+        assert(!v.Contains("gamma"));
+    }
+    {
+        Vector<int32_t> a;
+        Vector<int32_t> b;
+        for (int32_t i = 0; i < 100; ++i) {
+            a.PushBack(i);
+            b.PushBack(i);
+        }
+        assert(a == b); // memcmp path
+        b[99] = -1;
+        assert(a != b);
+        b.PopBack();
+        assert(a != b); // size mismatch short-circuits
+    }
+    {
+        Vector<std::string> a;
+        Vector<std::string> b;
+        a.PushBack("x");
+        b.PushBack("x");
+        assert(a == b); // std::equal path
+        b[0] = "y";
+        assert(a != b);
+    }
+}
+
+void TestHugePageAllocation() {
+#if defined(__linux__)
+    {
+        // Threshold of one page so the test crosses into the mmap regime
+        // without actually allocating gigabytes.
+        Vector<size_t, 0, HugePageAllocation<size_t, 4096>> v;
+        const size_t SIZE = 100'000; // ~800 KB - mmap-backed
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Size() == SIZE);
+        for (size_t i = 0; i < SIZE; i += 997) {
+            assert(v[i] == i);
+        }
+        v.Resize(SIZE / 10);
+        v.AdviseFreeTail(); // cold tail pages go back to the kernel, capacity stays
+        assert(v.Capacity() >= SIZE);
+        assert(v[SIZE / 10 - 1] == SIZE / 10 - 1);
+        v.PushBack(42); // freed pages come back on demand
+        assert(v[SIZE / 10] == 42);
+        v.ShrinkToFit();
+        assert(v.Capacity() == SIZE / 10 + 1);
+    }
+    {
+        Vector<int, 0, HugePageAllocation<int, 4096>> v; // stays under the threshold
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack(i);
+        }
+        v.AdviseFreeTail(); // no-op in the operator new regime
+        assert(v[99] == 99);
+    }
+#endif
+}
+
+void TestAssign() {
+    const size_t SIZE = 100;
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(SIZE);
+        Vector<Obj> src(SIZE / 2);
+        size_t capacity = v.Capacity();
+        int destroyed_before = Obj::num_destroyed;
+        v.Assign(src.begin(), src.end()); // shrinking assign reuses the buffer
+        assert(v.Size() == SIZE / 2);
+        assert(v.Capacity() == capacity);
+        assert(Obj::num_copied == 0); // overlap handled by copy-assignment, not reconstruction
+        assert(Obj::num_destroyed == destroyed_before + static_cast<int>(SIZE - SIZE / 2));
+
+        Vector<Obj> bigger(SIZE * 2);
+        v.Assign(bigger.begin(), bigger.end()); // does not fit - one reallocation
+        assert(v.Size() == SIZE * 2);
+        assert(v.Capacity() == SIZE * 2);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(SIZE);
+        Vector<Obj> src(SIZE);
+        size_t capacity = v.Capacity();
+        v.AssignMove(src.begin(), src.end()); // elementwise move into existing storage
+        assert(v.Capacity() == capacity);
+        assert(Obj::num_copied == 0);
+        assert(Obj::num_moved == 0); // full overlap - only move-assignments, no constructions
+        assert(src.Size() == SIZE); // sources are moved-from but still alive
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        Vector<int> v;
+        int frame[] = { 1, 2, 3, 4, 5 };
+        v.Assign(std::begin(frame), std::end(frame)); // assign from a plain range
+        assert(v.Size() == 5);
+        assert(v[0] == 1 && v[4] == 5);
+        int next_frame[] = { 9, 8 };
+        v.Assign(std::begin(next_frame), std::end(next_frame));
+        assert(v.Size() == 2);
+        assert(v.Capacity() == 5); // capacity survived the frame swap
+        assert(v[0] == 9 && v[1] == 8);
+    }
+    {
+        Vector<std::string> v;
+        std::string src[] = { "one", "two" };
+        v.AssignMove(std::begin(src), std::end(src));
+        assert(v[0] == "one" && v[1] == "two");
+        assert(src[0].empty() && src[1].empty()); // contents stolen, not copied
+    }
+}
+
+void TestLazyVector() {
+    const size_t SIZE = 10'000;
+    {
+        Obj::ResetCounters();
+        {
+            LazyVector<Obj> v(SIZE);
+            assert(Obj::GetAliveObjectCount() == 0); // nothing constructed up front
+            assert(v.InitializedCount() == 0);
+
+            v[42].id = 1;
+            v[42].id = 2; // second touch must not re-construct
+            v[9'999].id = 3;
+            v[0].id = 4;
+            assert(Obj::num_default_constructed == 3);
+            assert(v.InitializedCount() == 3);
+            assert(v.IsInitialized(42) && !v.IsInitialized(43));
+            assert(v.Peek(42)->id == 2);
+            assert(v.Peek(43) == nullptr);
+
+            const LazyVector<Obj>& cv = v;
+            assert(cv[42].id == 2); // const access reads without constructing
+            assert(v.InitializedCount() == 3);
+
+            int visited = 0;
+            v.ForEachInitialized([&visited](size_t index, Obj& value) {
+                assert(index == 0 || index == 42 || index == 9'999);
+                assert(value.id != 0);
+                ++visited;
+            });
+            assert(visited == 3);
+        }
+        assert(Obj::num_destroyed == 3); // destructor skipped the untouched 9'997 slots
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        LazyVector<int> v(128);
+        v[7] = 70;
+        v[64] = 640; // second bitmap word
+        LazyVector<int> v_moved(std::move(v));
+        assert(v_moved.Size() == 128);
+        assert(v_moved.InitializedCount() == 2);
+        assert(v_moved[7] == 70 && v_moved[64] == 640);
+    }
+}
+
+void TestSortedVector() {
+    {
+        SortedVector<int> v;
+        for (int x : { 5, 1, 9, 3, 7 }) {
+            v.InsertSorted(x);
+        }
+        assert(v.Size() == 5);
+        assert(std::is_sorted(v.begin(), v.end()));
+        assert(v.Contains(7) && !v.Contains(4));
+        assert(*v.Find(9) == 9);
+        assert(v.Find(2) == v.end());
+
+        int batch[] = { 8, 2, 6, 2, 0 };
+        size_t capacity_before = v.Capacity();
+        v.MergeBatch(std::begin(batch), std::end(batch)); // one growth, one merge pass
+        assert(v.Size() == 10);
+        assert(std::is_sorted(v.begin(), v.end()));
+        assert(v.Capacity() >= capacity_before);
+        assert(v[0] == 0 && v[9] == 9);
+        assert(static_cast<size_t>(v.UpperBound(2) - v.LowerBound(2)) == 2); // duplicates kept adjacent
+
+        v.Erase(v.Find(3));
+        assert(v.Size() == 9);
+        assert(!v.Contains(3));
+        assert(std::is_sorted(v.begin(), v.end()));
+    }
+    {
+        SortedVector<int, std::greater<int>> v; // descending order via custom compare
+        int batch[] = { 4, 8, 1 };
+        v.MergeBatch(std::begin(batch), std::end(batch));
+        v.InsertSorted(6);
+        assert(std::is_sorted(v.begin(), v.end(), std::greater<int>()));
+        assert(v[0] == 8 && v[3] == 1);
+        assert(v.Contains(6));
+    }
+    {
+        std::string src[] = { "pear", "apple", "plum" };
+        SortedVector<std::string> v(std::begin(src), std::end(src)); // range constructor sorts
+        assert(v[0] == "apple" && v[2] == "plum");
+        assert(v.LowerBound("banana") == v.Find("pear"));
+    }
+}
+
+void TestBlocks() {
+    struct Row { // the aggregation-loop shape: a wide element scanned member-wise
+        int64_t key = 0;
+        int64_t metrics[14] = {};
+    };
+    static_assert(sizeof(Row) == 120);
+    const size_t SIZE = 10'000;
+    {
+        Vector<Row> v;
+        v.Reserve(SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            Row row;
+            row.key = static_cast<int64_t>(i);
+            v.PushBack(row);
+        }
+
+        size_t blocks = 0;
+        size_t seen = 0;
+        for (auto block : v.Blocks(4096)) {
+            assert(block.Size() == 4096 || seen + block.Size() == SIZE); // only the last block is short
+            assert(block.begin() == v.begin() + seen); // spans tile the buffer contiguously
+            seen += block.Size();
+            ++blocks;
+        }
+        assert(blocks == (SIZE + 4095) / 4096);
+        assert(seen == SIZE);
+
+        int64_t sum = 0;
+        const Vector<Row>& cv = v;
+        cv.ForEach([&sum](const Row& row) {
+            sum += row.key;
+        });
+        assert(sum == static_cast<int64_t>(SIZE) * (SIZE - 1) / 2);
+
+        v.ForEach([](Row& row) { // non-const tiles allow in-place updates
+            row.metrics[0] = row.key * 2;
+        });
+        assert(v[17].metrics[0] == 34);
+    }
+    {
+        Vector<int> v;
+        for (auto block : v.Blocks()) { // empty vector yields no blocks
+            (void)block;
+            assert(false);
+        }
+        v.PushBack(7);
+        size_t blocks = 0;
+        for (auto block : v.Blocks()) { // default tile, shorter vector: one partial block
+            assert(block.Size() == 1 && *block.begin() == 7);
+            ++blocks;
+        }
+        assert(blocks == 1);
+    }
+}
+
 int main() {
     try {
         Test1();
@@ -392,6 +1522,35 @@ int main() {
         Test3();
         Test4();
         Test5();
+        Test6();
+        TestTrivialInsert();
+        TestArenaAllocation();
+        TestAlignedAllocation();
+        TestAppendRange();
+        TestInsertRange();
+        TestCheckedAccess();
+        TestMoveAssignAndClear();
+        TestTelemetry();
+        TestConstexprVector();
+        TestResizeForOverwrite();
+        TestEraseOperations();
+        TestShrinkToFit();
+        TestGrowthPolicies();
+        TestGuaranteePolicy();
+        TestParallelResize();
+        TestCowVector();
+        TestAdoptRelease();
+        TestMappedVector();
+        TestSoaVector();
+        TestStableVector();
+        TestConcurrentVector();
+        TestSpillVector();
+        TestFindAndCompare();
+        TestHugePageAllocation();
+        TestAssign();
+        TestLazyVector();
+        TestSortedVector();
+        TestBlocks();
     }
     catch (const std::exception& e) {
         std::cerr << e.what() << std::endl;
@@ -0,0 +1,90 @@
+#pragma once
+#include "vector.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+#if defined(_WIN32)
+#error "mapped_vector.h requires a POSIX platform (mmap)"
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// File-backed persistence for vectors of trivially copyable records.
+// SaveMapped writes a small header plus the raw element bytes; LoadMapped
+// mmaps the file and hands the mapping to an AdoptedVector zero-copy, so
+// "deserializing" a multi-GB vector is a page-table operation and the OS
+// pages data in lazily on first access. The mapping is private
+// (copy-on-write): in-place element writes never touch the file, and
+// growth past the mapped capacity falls back to an ordinary heap buffer,
+// unmapping the file through the adoption deleter.
+
+struct MappedFileHeader {
+    static constexpr uint64_t kMagic = 0x564543544f525631; // "VECTORV1"
+
+    uint64_t magic = kMagic;
+    uint64_t count = 0;
+};
+
+namespace mapped_detail {
+
+    template <typename T>
+    void UnmapDeleter(T* buf, size_t capacity) {
+        auto* base = reinterpret_cast<unsigned char*>(buf) - sizeof(MappedFileHeader);
+        munmap(base, sizeof(MappedFileHeader) + capacity * sizeof(T));
+    }
+
+}  // namespace mapped_detail
+
+template <typename T, size_t InlineCapacity, typename Alloc, typename Growth, typename Guarantee>
+void SaveMapped(const Vector<T, InlineCapacity, Alloc, Growth, Guarantee>& v, const std::string& path) {
+    static_assert(std::is_trivially_copyable_v<T>, "only raw bytes of trivially copyable records can be mapped back");
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        throw std::runtime_error("SaveMapped: cannot open " + path);
+    }
+    MappedFileHeader header;
+    header.count = v.Size();
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    ok = ok && (v.Size() == 0 || std::fwrite(v.begin(), sizeof(T), v.Size(), file) == v.Size());
+    ok = (std::fclose(file) == 0) && ok;
+    if (!ok) {
+        throw std::runtime_error("SaveMapped: write failed for " + path);
+    }
+}
+
+template <typename T>
+AdoptedVector<T> LoadMapped(const std::string& path) {
+    static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable records can be mapped");
+    static_assert(alignof(T) <= sizeof(MappedFileHeader), "element alignment exceeds the header padding");
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("LoadMapped: cannot open " + path);
+    }
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(MappedFileHeader)) {
+        close(fd);
+        throw std::runtime_error("LoadMapped: bad file " + path);
+    }
+    void* base = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd); // the mapping keeps its own reference
+    if (base == MAP_FAILED) {
+        throw std::runtime_error("LoadMapped: mmap failed for " + path);
+    }
+    const auto* header = static_cast<const MappedFileHeader*>(base);
+    size_t count = header->count;
+    if (header->magic != MappedFileHeader::kMagic
+        || sizeof(MappedFileHeader) + count * sizeof(T) > static_cast<size_t>(st.st_size)) {
+        munmap(base, st.st_size);
+        throw std::runtime_error("LoadMapped: corrupt header in " + path);
+    }
+    T* elements = reinterpret_cast<T*>(static_cast<unsigned char*>(base) + sizeof(MappedFileHeader));
+    return AdoptedVector<T>::Adopt(elements, count, count, mapped_detail::UnmapDeleter<T>);
+}
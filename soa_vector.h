@@ -0,0 +1,198 @@
+#pragma once
+#include "vector.h"
+
+#include <tuple>
+
+// Structure-of-arrays companion to Vector: SoaVector<float, float, int>
+// keeps each field of the record in its own contiguous RawMemory array, so
+// loops touching a single field stream through memory without dragging the
+// rest of the record into cache. The API mirrors the Vector surface
+// (Size/Capacity/Reserve/EmplaceBack/PopBack); operator[] returns a tuple
+// of references acting as a proxy for the logical record.
+template <typename... Fields>
+class SoaVector {
+    static_assert(sizeof...(Fields) > 0, "a record needs at least one field");
+
+    template <size_t I>
+    using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    using FieldIndices = std::index_sequence_for<Fields...>;
+
+public:
+    /////_CONSTRUCTORS_/////////////////////////////////////
+    SoaVector() = default;
+
+    SoaVector(const SoaVector& other)
+        :arrays_(AllocateArrays(other.size_))
+        , capacity_(other.size_)
+    {
+        CopyAppendFrom(other, FieldIndices{});
+        size_ = other.size_;
+    }
+
+    SoaVector(SoaVector&& other) noexcept {
+        Swap(other);
+    }
+
+    SoaVector& operator=(const SoaVector& rhs) {
+        if (this != &rhs) {
+            SoaVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    SoaVector& operator=(SoaVector&& rhs) noexcept {
+        Swap(rhs);
+        return *this;
+    }
+
+    ~SoaVector() {
+        DestroyRange(0, size_, FieldIndices{});
+    }
+
+    /////_METHODS FOR SIZE/CAPACITY_/////////////////////////////////////
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return capacity_;
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity > capacity_) {
+            Grow(new_capacity);
+        }
+    }
+
+    /////_FIELD ACCESS_/////////////////////////////////////
+    // Contiguous array of one field: the pointer plus Size() form a span
+    // that vectorized per-field loops can stream over.
+    template <size_t I>
+    FieldType<I>* FieldData() noexcept {
+        return std::get<I>(arrays_).GetAddress();
+    }
+    template <size_t I>
+    const FieldType<I>* FieldData() const noexcept {
+        return std::get<I>(arrays_).GetAddress();
+    }
+
+    template <size_t I>
+    FieldType<I>& Field(size_t index) noexcept {
+        assert(index < size_);
+        return FieldData<I>()[index];
+    }
+    template <size_t I>
+    const FieldType<I>& Field(size_t index) const noexcept {
+        assert(index < size_);
+        return FieldData<I>()[index];
+    }
+
+    // Proxy for the whole logical record at `index`.
+    std::tuple<Fields&...> operator[](size_t index) noexcept {
+        assert(index < size_);
+        return RecordAt(index, FieldIndices{});
+    }
+    std::tuple<const Fields&...> operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return const_cast<SoaVector&>(*this).RecordAt(index, FieldIndices{});
+    }
+
+    /////_METHODS FOR ELEMENTS MODIFICATION_/////////////////////////////////////
+    template <typename... Args>
+    void EmplaceBack(Args&&... args) {
+        static_assert(sizeof...(Args) == sizeof...(Fields), "one argument per field");
+        if (size_ == capacity_) {
+            Grow(GrowthDoubling::Next(capacity_, size_ + 1));
+        }
+        size_t constructed = 0;
+        try {
+            ConstructAt(size_, constructed, FieldIndices{}, std::forward<Args>(args)...);
+        }
+        catch (...) { // roll back the fields already constructed for this record
+            DestroyPrefixAt(size_, constructed, FieldIndices{});
+            throw;
+        }
+        ++size_;
+    }
+
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        --size_;
+        DestroyRange(size_, 1, FieldIndices{});
+    }
+
+    /////_OTHER_//////////////////////////////////////////////////////////////////
+    void Swap(SoaVector& other) noexcept {
+        SwapArrays(other, FieldIndices{});
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+private:
+    std::tuple<RawMemory<Fields>...> arrays_;
+    size_t size_ = 0;
+    size_t capacity_ = 0;
+
+    static std::tuple<RawMemory<Fields>...> AllocateArrays(size_t capacity) {
+        return std::tuple<RawMemory<Fields>...>{ RawMemory<Fields>(capacity)... };
+    }
+
+    template <size_t... Is>
+    std::tuple<Fields&...> RecordAt(size_t index, std::index_sequence<Is...>) noexcept {
+        return std::tie(FieldData<Is>()[index]...);
+    }
+
+    template <size_t... Is, typename... Args>
+    void ConstructAt(size_t index, size_t& constructed, std::index_sequence<Is...>, Args&&... args) {
+        ((new (FieldData<Is>() + index) FieldType<Is>(std::forward<Args>(args)), ++constructed), ...);
+    }
+
+    template <size_t... Is>
+    void DestroyPrefixAt(size_t index, size_t count, std::index_sequence<Is...>) noexcept {
+        (([&] {
+            if (Is < count) {
+                std::destroy_at(FieldData<Is>() + index);
+            }
+        }()), ...);
+    }
+
+    template <size_t... Is>
+    void DestroyRange(size_t from, size_t count, std::index_sequence<Is...>) noexcept {
+        ((std::destroy_n(FieldData<Is>() + from, count)), ...);
+    }
+
+    template <size_t... Is>
+    void SwapArrays(SoaVector& other, std::index_sequence<Is...>) noexcept {
+        ((std::get<Is>(arrays_).Swap(std::get<Is>(other.arrays_))), ...);
+    }
+
+    template <size_t... Is>
+    void CopyAppendFrom(const SoaVector& other, std::index_sequence<Is...>) {
+        ((std::uninitialized_copy_n(other.FieldData<Is>(), other.size_, FieldData<Is>())), ...);
+    }
+
+    // Reallocate every field array to new_capacity; like Vector, each field
+    // is moved when the move constructor is noexcept and copied otherwise.
+    void Grow(size_t new_capacity) {
+        auto new_arrays = AllocateArrays(new_capacity);
+        TransferArrays(new_arrays, FieldIndices{});
+        DestroyRange(0, size_, FieldIndices{});
+        arrays_.swap(new_arrays);
+        capacity_ = new_capacity;
+    }
+
+    template <size_t... Is>
+    void TransferArrays(std::tuple<RawMemory<Fields>...>& new_arrays, std::index_sequence<Is...>) {
+        (([&] {
+            using F = FieldType<Is>;
+            if constexpr (std::is_nothrow_move_constructible_v<F> || !std::is_copy_constructible_v<F>) {
+                std::uninitialized_move_n(FieldData<Is>(), size_, std::get<Is>(new_arrays).GetAddress());
+            }
+            else {
+                std::uninitialized_copy_n(FieldData<Is>(), size_, std::get<Is>(new_arrays).GetAddress());
+            }
+        }()), ...);
+    }
+};
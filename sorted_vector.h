@@ -0,0 +1,106 @@
+#pragma once
+#include "vector.h"
+
+#include <functional>
+
+// Flat sorted adapter over Vector, for the flat-map workloads where a
+// sorted array beats node-based maps on lookups. Single keys go in with
+// lower_bound + Insert as before; the point of the adapter is MergeBatch,
+// which appends the whole batch with one growth decision, sorts it and
+// folds it in with a single in-place merge pass - one tail shift per BATCH
+// instead of one per key. Iteration is const-only so nothing can break the
+// ordering invariant behind the adapter's back.
+template <typename T, typename Compare = std::less<T>>
+class SortedVector {
+public:
+    /////_CONSTRUCTORS_/////////////////////////////////////
+    SortedVector() = default;
+
+    explicit SortedVector(Compare comp)
+        :comp_(std::move(comp)) {
+    }
+
+    template <typename InputIt>
+    SortedVector(InputIt first, InputIt last, Compare comp = Compare{})
+        :comp_(std::move(comp)) {
+        data_.AppendRange(first, last);
+        std::sort(data_.begin(), data_.end(), comp_);
+    }
+
+    /////_ITERATORS_/////////////////////////////////////
+    using const_iterator = typename Vector<T>::const_iterator;
+
+    const_iterator begin() const noexcept {
+        return data_.begin();
+    }
+    const_iterator end() const noexcept {
+        return data_.end();
+    }
+
+    /////_OVERLOADS_/////////////////////////////////////
+    const T& operator[](size_t index) const noexcept {
+        return data_[index];
+    }
+
+    /////_METHODS FOR SIZE/CAPACITY_/////////////////////////////////////
+    size_t Size() const noexcept {
+        return data_.Size();
+    }
+
+    size_t Capacity() const noexcept {
+        return data_.Capacity();
+    }
+
+    void Reserve(size_t new_capacity) {
+        data_.Reserve(new_capacity);
+    }
+
+    void Clear() noexcept {
+        data_.Clear();
+    }
+
+    /////_METHODS FOR ELEMENTS MODIFICATION_/////////////////////////////////////
+    const_iterator InsertSorted(const T& value) {
+        return data_.Insert(LowerBound(value), value);
+    }
+    const_iterator InsertSorted(T&& value) {
+        return data_.Insert(LowerBound(value), std::move(value));
+    }
+
+    // Merge a whole batch with one growth decision, one sort of the batch
+    // and one in-place merge - the update-heavy path that one-at-a-time
+    // insertion (a tail shift per key) cannot afford.
+    template <typename InputIt>
+    void MergeBatch(InputIt first, InputIt last) {
+        size_t old_size = data_.Size();
+        data_.AppendRange(first, last);
+        std::sort(data_.begin() + old_size, data_.end(), comp_);
+        std::inplace_merge(data_.begin(), data_.begin() + old_size, data_.end(), comp_);
+    }
+
+    const_iterator Erase(const_iterator pos) {
+        return data_.Erase(pos);
+    }
+
+    /////_LOOKUPS_/////////////////////////////////////
+    const_iterator LowerBound(const T& value) const noexcept {
+        return std::lower_bound(begin(), end(), value, comp_);
+    }
+
+    const_iterator UpperBound(const T& value) const noexcept {
+        return std::upper_bound(begin(), end(), value, comp_);
+    }
+
+    const_iterator Find(const T& value) const noexcept {
+        const_iterator it = LowerBound(value);
+        return it != end() && !comp_(value, *it) ? it : end();
+    }
+
+    bool Contains(const T& value) const noexcept {
+        return Find(value) != end();
+    }
+
+private:
+    Vector<T> data_;
+    Compare comp_{};
+};
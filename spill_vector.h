@@ -0,0 +1,169 @@
+#pragma once
+#include "vector.h"
+
+#include <cstdio>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#error "spill_vector.h requires a POSIX platform (pread)"
+#endif
+
+#include <unistd.h>
+
+// Larger-than-RAM append buffer for sequential-scan batch jobs: PushBack
+// fills a bounded in-memory window (one RawMemory buffer) and every time the
+// window fills up its contents are spilled as a segment to an unlinked temp
+// file, so resident memory stays at one window regardless of element count.
+// Iteration is segment-aware: spilled segments are read back one window at a
+// time through a single-segment cache, which a sequential scan hits once per
+// segment. Random access works but re-reads a segment per cache miss - these
+// jobs are scan-dominated, so that is the right trade.
+template <typename T>
+class SpillVector {
+    static_assert(std::is_trivially_copyable_v<T>, "only raw bytes of trivially copyable elements can be spilled");
+
+public:
+    /////_CONSTRUCTORS_/////////////////////////////////////
+    explicit SpillVector(size_t window_elements = size_t{ 1 } << 16)
+        :window_(window_elements)
+        , window_elements_(window_elements) {
+        assert(window_elements > 0);
+    }
+
+    SpillVector(const SpillVector& other) = delete; // owns a temp file, identity is pinned
+    SpillVector& operator=(const SpillVector& rhs) = delete;
+
+    ~SpillVector() {
+        if (file_ != nullptr) {
+            std::fclose(file_); // tmpfile is unlinked - closing frees the disk space
+        }
+    }
+
+    /////_ITERATORS_/////////////////////////////////////
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() = default;
+        const_iterator(const SpillVector* owner, size_t index) noexcept
+            :owner_(owner)
+            , index_(index) {
+        }
+
+        reference operator*() const {
+            return owner_->ElementAt(index_);
+        }
+        pointer operator->() const {
+            return &owner_->ElementAt(index_);
+        }
+
+        const_iterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+        const_iterator operator++(int) noexcept {
+            const_iterator old(*this);
+            ++index_;
+            return old;
+        }
+
+        bool operator==(const const_iterator& rhs) const noexcept {
+            return index_ == rhs.index_;
+        }
+        bool operator!=(const const_iterator& rhs) const noexcept {
+            return !(*this == rhs);
+        }
+
+    private:
+        const SpillVector* owner_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+    const_iterator end() const noexcept {
+        return const_iterator(this, Size());
+    }
+
+    /////_OVERLOADS_/////////////////////////////////////
+    const T& operator[](size_t index) const {
+        VECTOR_VERIFY_INDEX(index < Size());
+        return ElementAt(index);
+    }
+
+    /////_METHODS FOR SIZE/CAPACITY_/////////////////////////////////////
+    size_t Size() const noexcept {
+        return spilled_ + window_count_;
+    }
+
+    size_t WindowElements() const noexcept {
+        return window_elements_;
+    }
+
+    size_t SpilledElements() const noexcept { // how much lives on disk right now
+        return spilled_;
+    }
+
+    /////_METHODS FOR ELEMENTS MODIFICATION_/////////////////////////////////////
+    void PushBack(const T& value) {
+        if (window_count_ == window_elements_) {
+            SpillWindow();
+        }
+        window_[window_count_++] = value;
+    }
+
+private:
+    static constexpr size_t kNoSegment = static_cast<size_t>(-1);
+
+    RawMemory<T> window_;
+    size_t window_elements_ = 0;
+    size_t window_count_ = 0;
+    size_t spilled_ = 0;
+    std::FILE* file_ = nullptr;
+
+    mutable RawMemory<T> cache_; // one spilled segment, refilled on miss
+    mutable size_t cache_segment_ = kNoSegment;
+
+    void SpillWindow() { // segments are always full windows, so offsets are index arithmetic
+        if (file_ == nullptr) {
+            file_ = std::tmpfile();
+            if (file_ == nullptr) {
+                throw std::runtime_error("SpillVector: cannot create temp file");
+            }
+        }
+        if (std::fwrite(window_.GetAddress(), sizeof(T), window_count_, file_) != window_count_
+            || std::fflush(file_) != 0) { // flushed so pread sees the bytes
+            throw std::runtime_error("SpillVector: spill write failed");
+        }
+        spilled_ += window_count_; // segments are immutable once written, the cache stays valid
+        window_count_ = 0;
+    }
+
+    const T& ElementAt(size_t index) const {
+        if (index >= spilled_) { // still in the hot window
+            return window_[index - spilled_];
+        }
+        size_t segment = index / window_elements_;
+        if (segment != cache_segment_) {
+            LoadSegment(segment);
+        }
+        return cache_[index % window_elements_];
+    }
+
+    void LoadSegment(size_t segment) const {
+        if (cache_.Capacity() == 0) {
+            cache_ = RawMemory<T>(window_elements_);
+        }
+        ssize_t bytes = window_elements_ * sizeof(T);
+        off_t offset = static_cast<off_t>(segment) * bytes;
+        if (pread(fileno(file_), cache_.GetAddress(), bytes, offset) != bytes) {
+            throw std::runtime_error("SpillVector: segment read failed");
+        }
+        cache_segment_ = segment;
+    }
+};
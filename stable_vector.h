@@ -0,0 +1,186 @@
+#pragma once
+#include "vector.h"
+
+// Segmented companion to Vector: elements live in fixed-size RawMemory
+// chunks tracked by a Vector of chunks, so append is O(1) and NEVER moves an
+// existing element - pointers and references stay valid for the lifetime of
+// the container (growth reallocates the chunk table, not the chunks). The
+// price is one extra indirection per random access; iteration walks each
+// chunk contiguously. The Size/EmplaceBack/operator[] surface matches
+// Vector so call sites can switch per use case.
+template <typename T, size_t ChunkElements = 256>
+class StableVector {
+    static_assert(ChunkElements > 0, "chunk must hold at least one element");
+
+public:
+    /////_CONSTRUCTORS_/////////////////////////////////////
+    StableVector() = default;
+
+    StableVector(const StableVector& other) {
+        try {
+            for (const T& value : other) {
+                PushBack(value);
+            }
+        }
+        catch (...) {
+            DestroyAll();
+            throw;
+        }
+    }
+
+    StableVector(StableVector&& other) noexcept {
+        Swap(other);
+    }
+
+    StableVector& operator=(const StableVector& rhs) {
+        if (this != &rhs) {
+            StableVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    StableVector& operator=(StableVector&& rhs) noexcept {
+        Swap(rhs);
+        return *this;
+    }
+
+    ~StableVector() {
+        DestroyAll();
+    }
+
+    /////_ITERATORS_/////////////////////////////////////
+    template <bool IsConst>
+    class BasicIterator {
+        using Owner = std::conditional_t<IsConst, const StableVector, StableVector>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        BasicIterator() = default;
+        BasicIterator(Owner* owner, size_t index) noexcept
+            :owner_(owner)
+            , index_(index) {
+        }
+        BasicIterator(const BasicIterator<false>& other) noexcept // iterator -> const_iterator
+            :owner_(other.owner_)
+            , index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return (*owner_)[index_];
+        }
+        pointer operator->() const noexcept {
+            return &(*owner_)[index_];
+        }
+
+        BasicIterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old(*this);
+            ++index_;
+            return old;
+        }
+
+        bool operator==(const BasicIterator& rhs) const noexcept {
+            return index_ == rhs.index_;
+        }
+        bool operator!=(const BasicIterator& rhs) const noexcept {
+            return !(*this == rhs);
+        }
+
+    private:
+        friend class StableVector;
+        friend class BasicIterator<true>;
+
+        Owner* owner_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+
+    iterator begin() noexcept {
+        return iterator(this, 0);
+    }
+    iterator end() noexcept {
+        return iterator(this, size_);
+    }
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+    const_iterator end() const noexcept {
+        return const_iterator(this, size_);
+    }
+
+    /////_OVERLOADS_/////////////////////////////////////
+    T& operator[](size_t index) noexcept {
+        VECTOR_VERIFY_INDEX(index < size_);
+        return *AddressOf(index);
+    }
+    const T& operator[](size_t index) const noexcept {
+        return (*const_cast<StableVector*>(this))[index];
+    }
+
+    /////_METHODS FOR SIZE/CAPACITY_/////////////////////////////////////
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return chunks_.Size() * ChunkElements;
+    }
+
+    /////_METHODS FOR ELEMENTS MODIFICATION_/////////////////////////////////////
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        if (size_ == Capacity()) {
+            chunks_.EmplaceBack(RawMemory<T>(ChunkElements)); // only the chunk table moves, never an element
+        }
+        T* slot = AddressOf(size_);
+        new (slot) T(std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+    void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        --size_;
+        std::destroy_at(AddressOf(size_));
+    }
+
+    /////_OTHER_//////////////////////////////////////////////////////////////////
+    void Swap(StableVector& other) noexcept {
+        chunks_.Swap(other.chunks_);
+        std::swap(size_, other.size_);
+    }
+
+private:
+    Vector<RawMemory<T>> chunks_;
+    size_t size_ = 0;
+
+    T* AddressOf(size_t index) noexcept {
+        return chunks_[index / ChunkElements].GetAddress() + index % ChunkElements;
+    }
+
+    void DestroyAll() noexcept { // chunks only hold raw memory - element lifetimes are ours to end
+        for (size_t chunk = 0; chunk * ChunkElements < size_; ++chunk) {
+            size_t in_chunk = std::min(ChunkElements, size_ - chunk * ChunkElements);
+            std::destroy_n(chunks_[chunk].GetAddress(), in_chunk);
+        }
+        size_ = 0;
+    }
+};
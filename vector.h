@@ -1,42 +1,415 @@
-﻿#pragma once
+#pragma once
 #include <cassert>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <new>
 #include <utility>
 #include <memory>
 #include <type_traits>
 #include <algorithm>
 #include <iterator>
+#include <exception>
+#include <stdexcept>
+#include <thread>
 
 #include <iostream>
 
+#if defined(__linux__)
+#include <sys/mman.h> // hugepage-backed allocation policy
+#endif
+
+/////_BOUNDS CHECKING_/////////////////////////////////////
+// Three access modes for operator[]:
+//  - debug builds (no NDEBUG): plain assert, as before;
+//  - release builds: no check at all, plus an assume-hint on the bound so
+//    the optimizer can drop range checks and vectorize index loops;
+//  - canary builds (-DVECTOR_BOUNDS_CHECK): the check stays on even with
+//    NDEBUG, aborting on violation.
+// At() always checks and throws, independent of the build mode.
+#if defined(__clang__)
+#define VECTOR_ASSUME(cond) __builtin_assume(cond)
+#elif defined(__GNUC__)
+#define VECTOR_ASSUME(cond) do { if (!(cond)) __builtin_unreachable(); } while (false)
+#elif defined(_MSC_VER)
+#define VECTOR_ASSUME(cond) __assume(cond)
+#else
+#define VECTOR_ASSUME(cond) ((void)0)
+#endif
+
+#if defined(VECTOR_BOUNDS_CHECK)
+#define VECTOR_VERIFY_INDEX(cond) do { if (!(cond)) { std::abort(); } } while (false)
+#elif !defined(NDEBUG)
+#define VECTOR_VERIFY_INDEX(cond) assert(cond)
+#else
+#define VECTOR_VERIFY_INDEX(cond) VECTOR_ASSUME(cond)
+#endif
+
+// Read-prefetch hint for the block iteration API below; a no-op where the
+// compiler has no intrinsic for it.
+#if defined(__GNUC__) || defined(__clang__)
+#define VECTOR_PREFETCH(addr) __builtin_prefetch((addr), 0 /*read*/, 3 /*keep in all cache levels*/)
+#else
+#define VECTOR_PREFETCH(addr) ((void)0)
+#endif
+
+/////_TELEMETRY_/////////////////////////////////////
+// Opt-in growth instrumentation (-DVECTOR_TELEMETRY): per element type,
+// counts reallocations, bytes transferred between buffers, element copies
+// vs moves and the peak capacity seen, so reallocation storms can be
+// attributed to their owners. When the macro is off the hooks compile to
+// empty inline functions - zero code, zero data.
+#if defined(VECTOR_TELEMETRY)
+#include <atomic>
+#include <typeinfo>
+
+struct VectorTelemetryStats {
+    std::atomic<size_t> reallocations{ 0 };
+    std::atomic<size_t> bytes_transferred{ 0 };
+    std::atomic<size_t> element_copies{ 0 }; // transfers that had to deep-copy
+    std::atomic<size_t> element_moves{ 0 };
+    std::atomic<size_t> peak_capacity{ 0 };
+
+    const char* type_name = "";
+    VectorTelemetryStats* next = nullptr; // intrusive registry list, no allocation
+};
+
+inline std::atomic<VectorTelemetryStats*>& VectorTelemetryHead() {
+    static std::atomic<VectorTelemetryStats*> head{ nullptr };
+    return head;
+}
+
+template <typename T>
+VectorTelemetryStats& VectorTelemetryFor() {
+    static VectorTelemetryStats stats;
+    static bool registered = [] { // link into the registry once per type
+        stats.type_name = typeid(T).name();
+        stats.next = VectorTelemetryHead().load();
+        while (!VectorTelemetryHead().compare_exchange_weak(stats.next, &stats)) {
+        }
+        return true;
+    }();
+    (void)registered;
+    return stats;
+}
+
+inline void UpdateVectorTelemetryMax(std::atomic<size_t>& target, size_t value) noexcept {
+    size_t current = target.load();
+    while (current < value && !target.compare_exchange_weak(current, value)) {
+    }
+}
+
+inline void DumpVectorTelemetry(std::ostream& out) {
+    for (const VectorTelemetryStats* stats = VectorTelemetryHead().load(); stats != nullptr; stats = stats->next) {
+        out << stats->type_name
+            << ": reallocations=" << stats->reallocations
+            << " bytes_transferred=" << stats->bytes_transferred
+            << " element_copies=" << stats->element_copies
+            << " element_moves=" << stats->element_moves
+            << " peak_capacity=" << stats->peak_capacity
+            << '\n';
+    }
+}
+#endif
+
+/////_SIMD SEARCH KERNELS_/////////////////////////////////////
+// Explicit equality-scan kernels for 4/8-byte integers: the generic
+// std::find loop does not reliably vectorize across our toolchains, so
+// Vector::Find/Contains dispatch here for trivially comparable T. Each
+// kernel returns the index of the first match, or count if absent; the
+// scalar tail loop doubles as the portable fallback.
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace simd_detail {
+
+    inline size_t FindEq32(const int32_t* data, size_t count, int32_t value) noexcept {
+        size_t i = 0;
+#if defined(__AVX2__)
+        __m256i needle = _mm256_set1_epi32(value);
+        for (; i + 8 <= count; i += 8) {
+            __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), needle);
+            int mask = _mm256_movemask_epi8(eq);
+            if (mask != 0) {
+                return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask))) / 4;
+            }
+        }
+#elif defined(__SSE2__)
+        __m128i needle = _mm_set1_epi32(value);
+        for (; i + 4 <= count; i += 4) {
+            __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), needle);
+            int mask = _mm_movemask_epi8(eq);
+            if (mask != 0) {
+                return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask))) / 4;
+            }
+        }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+        int32x4_t needle = vdupq_n_s32(value);
+        for (; i + 4 <= count; i += 4) {
+            uint32x4_t eq = vceqq_s32(vld1q_s32(data + i), needle);
+            if (vmaxvq_u32(eq) != 0) {
+                break; // the tail loop pins down the exact lane
+            }
+        }
+#endif
+        for (; i < count; ++i) {
+            if (data[i] == value) {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    inline size_t FindEq64(const int64_t* data, size_t count, int64_t value) noexcept {
+        size_t i = 0;
+#if defined(__AVX2__)
+        __m256i needle = _mm256_set1_epi64x(value);
+        for (; i + 4 <= count; i += 4) {
+            __m256i eq = _mm256_cmpeq_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), needle);
+            int mask = _mm256_movemask_epi8(eq);
+            if (mask != 0) {
+                return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask))) / 8;
+            }
+        }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+        int64x2_t needle = vdupq_n_s64(value);
+        for (; i + 2 <= count; i += 2) {
+            uint64x2_t eq = vceqq_s64(vld1q_s64(data + i), needle);
+            if (vgetq_lane_u64(eq, 0) != 0 || vgetq_lane_u64(eq, 1) != 0) {
+                break;
+            }
+        }
+#endif
+        // plain SSE2 has no 64-bit compare - the scalar loop is the kernel there
+        for (; i < count; ++i) {
+            if (data[i] == value) {
+                return i;
+            }
+        }
+        return count;
+    }
+
+}  // namespace simd_detail
+
+/////_ALLOCATION POLICIES_/////////////////////////////////////
+// Default policy: plain operator new / operator delete, stateless.
+template <typename T>
+struct NewDeleteAllocation {
+    T* Allocate(size_t n) { // Reserve space in memory
+        return n != 0 ? static_cast<T*>(operator new(n * sizeof(T))) : nullptr;
+    }
+
+    void Deallocate(T* buf, size_t /*n*/) noexcept { // Free space in memory
+        operator delete(buf);
+    }
+};
+
+// Over-aligned policy for SIMD-friendly buffers: every allocation is
+// aligned to Align bytes (64 by default, one cache line / AVX-512 lane),
+// so vectorized code may use aligned full-width loads from element zero.
+template <typename T, size_t Align = 64>
+struct AlignedAllocation {
+    static_assert(Align >= alignof(T), "Align must not weaken the natural alignment of T");
+    static_assert((Align & (Align - 1)) == 0, "Align must be a power of two");
+
+    T* Allocate(size_t n) {
+        return n != 0 ? static_cast<T*>(operator new(n * sizeof(T), std::align_val_t{ Align })) : nullptr;
+    }
+
+    void Deallocate(T* buf, size_t /*n*/) noexcept {
+        operator delete(buf, std::align_val_t{ Align });
+    }
+};
+
+// Policy for vectors that adopt an externally allocated buffer (RPC payload,
+// mmap region, ...): the adopted buffer is freed through the caller-supplied
+// deleter, while buffers allocated later by growth come from operator new.
+template <typename T>
+struct ExternalBufferAllocation {
+    using Deleter = void (*)(T* buf, size_t capacity);
+
+    T* Allocate(size_t n) {
+        // Growth replaces the adopted buffer with an ordinary heap one;
+        // this allocator copy no longer manages the adopted pointer.
+        adopted_ = nullptr;
+        deleter_ = nullptr;
+        return NewDeleteAllocation<T>{}.Allocate(n);
+    }
+
+    void Deallocate(T* buf, size_t n) noexcept {
+        if (buf != nullptr && buf == adopted_) {
+            deleter_(buf, n);
+        }
+        else {
+            NewDeleteAllocation<T>{}.Deallocate(buf, n);
+        }
+    }
+
+    T* adopted_ = nullptr;
+    Deleter deleter_ = nullptr;
+};
+
+#if defined(__linux__)
+// Policy for multi-GB scan buffers: allocations of ThresholdBytes or more
+// come from anonymous mmap, 2MB-aligned and marked MADV_HUGEPAGE, so the
+// kernel backs them with transparent huge pages and the scan phase stops
+// paying dTLB misses. Smaller buffers fall through to operator new.
+// ReleaseTail lets Vector::AdviseFreeTail hand cold capacity back to the
+// kernel (MADV_FREE) without giving up the buffer.
+template <typename T, size_t ThresholdBytes = (size_t{ 2 } << 20)>
+struct HugePageAllocation {
+    static constexpr size_t kHugePageBytes = size_t{ 2 } << 20;
+
+    T* Allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        if (n * sizeof(T) < ThresholdBytes) {
+            return NewDeleteAllocation<T>{}.Allocate(n);
+        }
+        void* buf = mmap(nullptr, MappedBytes(n), PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (buf == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        madvise(buf, MappedBytes(n), MADV_HUGEPAGE); // advisory - a refusal just means 4K pages
+        return static_cast<T*>(buf);
+    }
+
+    void Deallocate(T* buf, size_t n) noexcept {
+        if (buf == nullptr) {
+            return;
+        }
+        if (n * sizeof(T) < ThresholdBytes) {
+            NewDeleteAllocation<T>{}.Deallocate(buf, n);
+        }
+        else {
+            munmap(buf, MappedBytes(n));
+        }
+    }
+
+    // Let the kernel reclaim the page-aligned tail past live_n elements
+    // while the buffer stays owned; the pages come back zeroed on next use.
+    static void ReleaseTail(T* buf, size_t live_n, size_t capacity_n) noexcept {
+        if (capacity_n * sizeof(T) < ThresholdBytes) {
+            return; // operator new regime - nothing page-granular to give back
+        }
+        size_t keep = (live_n * sizeof(T) + kPageBytes - 1) / kPageBytes * kPageBytes;
+        size_t mapped = MappedBytes(capacity_n);
+        if (keep < mapped) {
+#if defined(MADV_FREE)
+            madvise(reinterpret_cast<unsigned char*>(buf) + keep, mapped - keep, MADV_FREE);
+#else
+            madvise(reinterpret_cast<unsigned char*>(buf) + keep, mapped - keep, MADV_DONTNEED);
+#endif
+        }
+    }
+
+private:
+    static constexpr size_t kPageBytes = 4096;
+
+    static size_t MappedBytes(size_t n) noexcept { // whole huge pages, so alignment holds
+        return (n * sizeof(T) + kHugePageBytes - 1) / kHugePageBytes * kHugePageBytes;
+    }
+};
+#endif
+
+// Bump region for per-request arenas: allocations advance an offset,
+// individual frees are no-ops and the whole region is released at once.
+class ArenaResource {
+public:
+    ArenaResource(void* buffer, size_t bytes) noexcept
+        :begin_(static_cast<unsigned char*>(buffer))
+        , capacity_(bytes) {
+    }
+
+    void* Allocate(size_t bytes, size_t alignment) {
+        size_t aligned = (used_ + alignment - 1) / alignment * alignment;
+        if (aligned + bytes > capacity_) {
+            throw std::bad_alloc();
+        }
+        used_ = aligned + bytes;
+        return begin_ + aligned;
+    }
+
+    void Release() noexcept { // frees everything allocated from the arena wholesale
+        used_ = 0;
+    }
+
+    size_t Used() const noexcept {
+        return used_;
+    }
+
+private:
+    unsigned char* begin_ = nullptr;
+    size_t capacity_ = 0;
+    size_t used_ = 0;
+};
+
+// Stateful policy binding vector storage to one arena.
 template <typename T>
+struct ArenaAllocation {
+    ArenaAllocation() = default;
+    explicit ArenaAllocation(ArenaResource& arena) noexcept
+        :arena_(&arena) {
+    }
+
+    T* Allocate(size_t n) {
+        assert(arena_ != nullptr);
+        return n != 0 ? static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T))) : nullptr;
+    }
+
+    void Deallocate(T* /*buf*/, size_t /*n*/) noexcept { // arena memory is released wholesale via ArenaResource::Release
+    }
+
+    ArenaResource* arena_ = nullptr;
+};
+
+
+
+template <typename T, typename Alloc = NewDeleteAllocation<T>>
 class RawMemory {
 public:
     /////_CONSTRUCTORS_/////////////////////////////////////
     RawMemory() = default;
 
     explicit RawMemory(size_t capacity)
-        :buffer_(Allocate(capacity)),
+        :buffer_(alloc_.Allocate(capacity)),
         capacity_(capacity) {
     }
 
+    RawMemory(size_t capacity, const Alloc& alloc)
+        :alloc_(alloc)
+        , buffer_(alloc_.Allocate(capacity))
+        , capacity_(capacity) {
+    }
+
+    RawMemory(T* adopted_buffer, size_t capacity, const Alloc& alloc) noexcept // take ownership without allocating
+        :alloc_(alloc)
+        , buffer_(adopted_buffer)
+        , capacity_(capacity) {
+    }
+
     RawMemory(const RawMemory& other) = delete;
     RawMemory(RawMemory&& other) noexcept {
         Swap(other);
     }
 
     ~RawMemory() {
-        Deallocate(buffer_);
+        alloc_.Deallocate(buffer_, capacity_);
     }
     /////_СOPY & ASSIGN FOR EQUAL_/////////////////////////////////////
-    
-    RawMemory& operator=(const RawMemory& rhs) = delete;    
+
+    RawMemory& operator=(const RawMemory& rhs) = delete;
     RawMemory& operator=(RawMemory&& rhs) noexcept {
         if (buffer_ != nullptr) {
-            Deallocate(buffer_);
+            alloc_.Deallocate(buffer_, capacity_);
         }
         buffer_ = nullptr;
+        capacity_ = 0;
         Swap(rhs);
         return *this;
     }
@@ -52,7 +425,7 @@ public:
     }
 
     T& operator[](size_t index) noexcept {
-        assert(index < capacity_);
+        VECTOR_VERIFY_INDEX(index < capacity_);
         return buffer_[index];
     }
 
@@ -62,6 +435,7 @@ public:
 
     /////_ADDITIONAL METHODS_/////////////////////////////////////
     void Swap(RawMemory& other) {
+        std::swap(alloc_, other.alloc_);
         std::swap(buffer_, other.buffer_);
         std::swap(capacity_, other.capacity_);
     }
@@ -77,49 +451,128 @@ public:
         return capacity_;
     }
 
+    const Alloc& GetAllocator() const noexcept {
+        return alloc_;
+    }
+
+    T* Release() noexcept { // give the buffer up to the caller without deallocating
+        T* released = buffer_;
+        buffer_ = nullptr;
+        capacity_ = 0;
+        return released;
+    }
+
 private:
+    Alloc alloc_; // declared first so constructors may allocate through it
     T* buffer_ = nullptr;
     size_t capacity_ = 0;
+};
 
-    static T* Allocate(size_t n) { // Reserve space in memory
-        return n != 0 ? static_cast<T*>(operator new(n * sizeof(T))) : nullptr;
+/////_GROWTH POLICIES_/////////////////////////////////////
+// A policy answers one question: the buffer holds `current` elements and at
+// least `required` are needed - what capacity should the next buffer have?
+
+struct GrowthDoubling { // classic 2x, best amortization
+    static size_t Next(size_t current, size_t required) noexcept {
+        return std::max(required, current == 0 ? size_t{ 1 } : current * 2);
     }
+};
 
-    static void Deallocate(T* buf) noexcept { // Free space in memory
-        operator delete(buf);
+struct Growth3By2 { // 1.5x, smaller transient memory spike during reallocation
+    static size_t Next(size_t current, size_t required) noexcept {
+        return std::max(required, current + current / 2 + 1);
     }
 };
 
+// Double while small, then grow by a fixed chunk: caps the transient spike
+// for multi-GB vectors at current + ChunkElements instead of 3x current.
+template <size_t ChunkElements>
+struct GrowthChunked {
+    static_assert(ChunkElements > 0, "chunk must hold at least one element");
 
+    static size_t Next(size_t current, size_t required) noexcept {
+        size_t next = current < ChunkElements ? GrowthDoubling::Next(current, required) : current + ChunkElements;
+        return std::max(required, next);
+    }
+};
+
+/////_EXCEPTION GUARANTEE POLICIES_/////////////////////////////////////
+// Strong (the default): reallocation copies elements when T's move
+// constructor may throw, so a failed reallocation leaves the vector intact.
+struct GuaranteeStrong {};
+
+// Basic: reallocation always moves, even when the move constructor may
+// throw. For legacy types with formally-throwing moves this avoids a full
+// deep copy on every growth; if a move does throw, the vector is left
+// valid but with unspecified contents.
+struct GuaranteeBasic {};
+
+/////_SMALL BUFFER STORAGE_/////////////////////////////////////
+// Inline storage for the first InlineCapacity elements of Vector.
+// For InlineCapacity == 0 the specialization is an empty base, so the
+// default Vector<T> keeps its old layout and codegen.
+template <typename T, size_t Capacity>
+class InlineBuffer {
+protected:
+    T* InlineAddress() noexcept {
+        return std::launder(reinterpret_cast<T*>(raw_));
+    }
+    const T* InlineAddress() const noexcept {
+        return std::launder(reinterpret_cast<const T*>(raw_));
+    }
+
+private:
+    alignas(T) unsigned char raw_[Capacity * sizeof(T)];
+};
 
 template <typename T>
-class Vector {
+class InlineBuffer<T, 0> {
+protected:
+    T* InlineAddress() noexcept {
+        return nullptr;
+    }
+    const T* InlineAddress() const noexcept {
+        return nullptr;
+    }
+};
+
+
+
+template <typename T, size_t InlineCapacity = 0, typename Alloc = NewDeleteAllocation<T>, typename Growth = GrowthDoubling, typename Guarantee = GuaranteeStrong>
+class Vector : private InlineBuffer<T, InlineCapacity> {
+    static_assert(std::is_same_v<Guarantee, GuaranteeStrong> || std::is_same_v<Guarantee, GuaranteeBasic>,
+        "Guarantee must be GuaranteeStrong or GuaranteeBasic");
 public:
     /////_CONSTRUCTORS_/////////////////////////////////////
     Vector() = default;
 
-    Vector(size_t n)
-        :data_(n)
+    explicit Vector(const Alloc& alloc)
+        :data_(0, alloc)
+    {
+    }
+
+    Vector(size_t n, const Alloc& alloc = Alloc{})
+        :data_(HeapCapacityFor(n), alloc)
         , size_(n)
     {
-        std::uninitialized_value_construct_n(data_.GetAddress(), n);
+        std::uninitialized_value_construct_n(Data(), n);
     }
 
     Vector(const Vector& other)
-        :data_(other.size_)
+        :data_(HeapCapacityFor(other.size_), other.data_.GetAllocator())
         , size_(other.size_)
     {
-        std::uninitialized_copy_n(other.data_.GetAddress(), other.size_, data_.GetAddress());
+        std::uninitialized_copy_n(other.Data(), other.size_, Data());
     }
 
-    Vector(Vector&& other) noexcept
+    Vector(Vector&& other) noexcept(kSwapIsNoexcept)
     {
         Swap(other);
     }
 
     ~Vector()
     {
-        std::destroy_n(data_.GetAddress(), size_);
+        std::destroy_n(Data(), size_);
     }
 
     /////_ITERATORS_/////////////////////////////////////
@@ -127,16 +580,16 @@ public:
     using const_iterator = const T*;
 
     iterator begin() noexcept {
-        return data_.GetAddress();
+        return Data();
     }
     iterator end() noexcept {
-        return data_.GetAddress() + size_;
+        return Data() + size_;
     }
     const_iterator begin() const noexcept {
-        return data_.GetAddress();
+        return Data();
     }
     const_iterator end() const noexcept {
-        return data_.GetAddress() + size_;
+        return Data() + size_;
     }
 
     const_iterator cbegin() const noexcept {
@@ -147,31 +600,45 @@ public:
     }
 
     iterator operator+(size_t n) noexcept {
-        return data_.GetAddress() + size_;
+        return Data() + size_;
     }
 
     /////_OVERLOADS_/////////////////////////////////////
     Vector& operator=(const Vector& rhs) {
         if (this != &rhs) {
-            if (rhs.size_ > data_.Capacity()) { // another vector is BIGGER
+            if (rhs.size_ > Capacity()) { // another vector is BIGGER
                 Vector rhs_copy(rhs);
                 Swap(rhs_copy);
             }
             else { // another vector is LESS
                 std::copy_n(rhs.begin(), std::min(size_, rhs.size_), begin());
-                if (size_ > rhs.size_) {  
-                    std::destroy_n(data_.GetAddress() + rhs.size_, size_ - rhs.size_); // free unused elements
+                if (size_ > rhs.size_) {
+                    std::destroy_n(Data() + rhs.size_, size_ - rhs.size_); // free unused elements
                 }
-                else { 
-                    std::uninitialized_copy_n(rhs.data_.GetAddress() + size_, rhs.size_ - size_, data_.GetAddress() + size_); // copy elements with memory initialization in range [size_ + 1, rhs.size_)
+                else {
+                    std::uninitialized_copy_n(rhs.Data() + size_, rhs.size_ - size_, Data() + size_); // copy elements with memory initialization in range [size_ + 1, rhs.size_)
                 }
                 size_ = rhs.size_;
             }
         }
         return *this;
     }
-    Vector& operator=(Vector&& rhs) noexcept {        
-        Swap(rhs);        
+    // Destroying move-assign: the current buffer is freed eagerly instead of
+    // being parked in rhs, so assigning over a multi-GB vector returns its
+    // memory immediately rather than when the moved-from temporary dies.
+    Vector& operator=(Vector&& rhs) noexcept(kSwapIsNoexcept) {
+        if (this == &rhs) {
+            return *this;
+        }
+        if constexpr (kHasInline) {
+            Swap(rhs); // inline elements cannot be stolen by pointer, fall back to swap
+        }
+        else {
+            std::destroy_n(Data(), size_);
+            data_ = std::move(rhs.data_); // RawMemory move-assign deallocates our old buffer
+            size_ = rhs.size_;
+            rhs.size_ = 0;
+        }
         return *this;
     }
 
@@ -180,13 +647,25 @@ public:
     }
 
     T& operator[](size_t index) noexcept {
-        assert(index < size_);
-        return data_[index];
+        VECTOR_VERIFY_INDEX(index < size_);
+        return Data()[index];
+    }
+
+    // Always-checked access, independent of NDEBUG / VECTOR_BOUNDS_CHECK.
+    const T& At(size_t index) const {
+        return const_cast<Vector&>(*this).At(index);
+    }
+
+    T& At(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Vector::At: index out of range");
+        }
+        return Data()[index];
     }
 
     /////_METHODS FOR SIZE/CAPACITY_/////////////////////////////////////
     size_t Capacity() const noexcept {
-        return data_.Capacity();
+        return UsingInlineStorage() ? InlineCapacity : data_.Capacity();
     }
 
     size_t Size() const noexcept {
@@ -194,44 +673,135 @@ public:
     }
 
     void Reserve(size_t new_capacity) {
-        if (new_capacity <= data_.Capacity()) { // no need to reassign heap
+        if (new_capacity <= Capacity()) { // no need to reassign heap
             return;
         }
-        RawMemory<T> new_data(new_capacity); // new heap creation
-        TransferDataToNewHeap(data_.GetAddress(), size_, new_data.GetAddress());
-        std::destroy_n(data_.GetAddress(), size_); // destroy old values in heap
+        NoteReallocation(new_capacity);
+        RawMemory<T, Alloc> new_data(new_capacity, data_.GetAllocator()); // new heap creation
+        TransferDataToNewHeap(Data(), size_, new_data.GetAddress());
+        std::destroy_n(Data(), size_); // destroy old values in heap
         data_.Swap(new_data);
     }
 
     void Resize(size_t new_size) {
         if (size_ < new_size) {
-            if (new_size > data_.Capacity()) { // generate new heap if current heap is small
+            if (new_size > Capacity()) { // generate new heap if current heap is small
                 Reserve(new_size);
             }
-            std::uninitialized_value_construct_n(data_.GetAddress() + size_, new_size - size_); // initialize new elements by default
+            std::uninitialized_value_construct_n(Data() + size_, new_size - size_); // initialize new elements by default
         }
         else { // remove excess elements
-            std::destroy_n(data_.GetAddress() + new_size, size_ - new_size);
+            std::destroy_n(Data() + new_size, size_ - new_size);
+        }
+        size_ = new_size;
+    }
+
+
+    // Drop capacity left behind by the doubling growth policy; after a load
+    // phase this releases the up-to-2x dead tail back to the allocator.
+    void ShrinkToFit() {
+        if (UsingInlineStorage() || size_ == data_.Capacity()) {
+            return;
+        }
+        if constexpr (kHasInline) {
+            if (size_ <= InlineCapacity) { // small enough to move back into the object
+                TransferDataToNewHeap(data_.GetAddress(), size_, this->InlineAddress());
+                std::destroy_n(data_.GetAddress(), size_);
+                RawMemory<T, Alloc> released(std::move(data_)); // frees the heap buffer on scope exit
+                return;
+            }
+        }
+        NoteReallocation(size_);
+        RawMemory<T, Alloc> new_data(size_, data_.GetAllocator());
+        TransferDataToNewHeap(data_.GetAddress(), size_, new_data.GetAddress());
+        std::destroy_n(data_.GetAddress(), size_);
+        data_.Swap(new_data);
+    }
+
+    // Destroy all elements but keep the buffer for reuse.
+    void Clear() noexcept {
+        std::destroy_n(Data(), size_);
+        size_ = 0;
+    }
+
+    // Hand the pages past Size() back to the kernel without shrinking the
+    // buffer - for allocation policies with a ReleaseTail hook (see
+    // HugePageAllocation). Capacity is untouched; the cold pages simply
+    // stop counting against RSS until they are written again.
+    template <typename A = Alloc> // template so only tail-aware allocators need the hook
+    void AdviseFreeTail() noexcept {
+        static_assert(std::is_same_v<A, Alloc>, "A is deduced, do not pass it explicitly");
+        if (!UsingInlineStorage()) {
+            A::ReleaseTail(data_.GetAddress(), size_, data_.Capacity());
+        }
+    }
+
+    // Destroy all elements and release the buffer entirely.
+    void Reset() noexcept {
+        std::destroy_n(Data(), size_);
+        size_ = 0;
+        data_ = RawMemory<T, Alloc>(0, data_.GetAllocator());
+    }
+
+    // Opt-in parallel Resize for huge vectors: value-construction (growing)
+    // or destruction (shrinking) is partitioned across thread_count threads.
+    // On exception each worker rolls back its own partition, completed
+    // partitions are destroyed afterwards and the size stays unchanged -
+    // the same all-or-nothing semantics as the serial Resize.
+    void ResizeParallel(size_t new_size, size_t thread_count) {
+        size_t delta = size_ < new_size ? new_size - size_ : size_ - new_size;
+        if (thread_count <= 1 || delta < kParallelGrain * 2) { // not worth spawning threads
+            Resize(new_size);
+            return;
+        }
+        if (size_ < new_size) {
+            if (new_size > Capacity()) {
+                Reserve(new_size);
+            }
+            ConstructRangeParallel(Data() + size_, new_size - size_, thread_count);
+        }
+        else {
+            DestroyRangeParallel(Data() + new_size, size_ - new_size, thread_count);
         }
         size_ = new_size;
     }
 
+    // Resize without initializing new elements: for I/O buffers that are about
+    // to be overwritten anyway, so we don't zero-fill megabytes before read().
+    void ResizeForOverwrite(size_t new_size) {
+        static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>,
+            "ResizeForOverwrite is only valid for trivially constructible/destructible types");
+        if (new_size > Capacity()) {
+            Reserve(new_size);
+        }
+        size_ = new_size;
+    }
+
+    // Escape hatch for code that fills the buffer externally (e.g. a read()
+    // into begin()): just set the element count, no construction/destruction.
+    void SetSizeUnsafe(size_t new_size) noexcept {
+        static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>,
+            "SetSizeUnsafe is only valid for trivially constructible/destructible types");
+        assert(new_size <= Capacity());
+        size_ = new_size;
+    }
+
 
     /////_METHODS FOR ELEMENTS MODIFICATION_/////////////////////////////////////
     //////////_LAST ELEMENT_//////////////////////////////////////////////////////
     template <typename... Args>
     T& EmplaceBack(Args&&... args) {
-        if (size_ == data_.Capacity()) {
-            RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
+        if (size_ == Capacity()) {
+            RawMemory<T, Alloc> new_data = AllocateGrownBuffer(size_ + 1);
             new (new_data.GetAddress() + size_) T(std::forward<Args>(args)...);
-            TransferDataToNewHeap(data_.GetAddress(), size_, new_data.GetAddress());
-            std::destroy_n(data_.GetAddress(), size_);
+            TransferDataToNewHeap(Data(), size_, new_data.GetAddress());
+            std::destroy_n(Data(), size_);
             data_.Swap(new_data);
         }
         else {
-            new (data_.GetAddress() + size_) T(std::forward<Args>(args)...);
+            new (Data() + size_) T(std::forward<Args>(args)...);
         }
-        return data_[size_++];
+        return Data()[size_++];
     }
 
     void PushBack(const T& value) {
@@ -241,10 +811,61 @@ public:
         EmplaceBack(std::move(value));
     }
 
+    //////////_BULK APPEND_//////////////////////////////////////////////////////
+    // Append a whole range with one capacity check and at most one reallocation.
+    // The range must not point into this vector.
+    template <typename InputIt>
+    void AppendRange(InputIt first, InputIt last) {
+        size_t count = std::distance(first, last);
+        ReserveForAppend(count);
+        std::uninitialized_copy(first, last, Data() + size_);
+        size_ += count;
+    }
+
+    void AppendN(size_t count, const T& value) {
+        ReserveForAppend(count);
+        std::uninitialized_fill_n(Data() + size_, count, value);
+        size_ += count;
+    }
+
     void PopBack() noexcept {
-        assert(size_ > 0);        
-        std::destroy_at(data_.GetAddress() + size_ - 1);
-        --size_;       
+        assert(size_ > 0);
+        std::destroy_at(Data() + size_ - 1);
+        --size_;
+    }
+
+    //////////_BULK ASSIGN_//////////////////////////////////////////////////////
+    // Replace the contents with a range, reusing the existing buffer whenever
+    // capacity suffices - the range analogue of copy-assignment's in-place
+    // path, so per-frame rebuilds stop paying an allocation plus full
+    // construction. The range must not point into this vector.
+    template <typename InputIt>
+    void Assign(InputIt first, InputIt last) {
+        size_t count = std::distance(first, last);
+        if (count > Capacity()) { // existing buffer cannot hold the range
+            RawMemory<T, Alloc> new_data(count, data_.GetAllocator());
+            std::uninitialized_copy(first, last, new_data.GetAddress());
+            std::destroy_n(Data(), size_);
+            data_.Swap(new_data);
+        }
+        else {
+            size_t overlap = std::min(size_, count);
+            InputIt mid = std::next(first, overlap);
+            std::copy(first, mid, Data()); // assign over live elements
+            if (size_ > count) {
+                std::destroy_n(Data() + count, size_ - count); // free unused elements
+            }
+            else {
+                std::uninitialized_copy(mid, last, Data() + size_); // construct past the old size
+            }
+        }
+        size_ = count;
+    }
+
+    // Same reuse logic, but elements are moved out of the source range.
+    template <typename InputIt>
+    void AssignMove(InputIt first, InputIt last) {
+        Assign(std::make_move_iterator(first), std::make_move_iterator(last));
     }
 
     //////////_ANY POS OF ELEMENT_//////////////////////////////////////////////////////
@@ -254,21 +875,26 @@ public:
         if (this->cend() == pos) { // if pos point to hte end of vector
             EmplaceBack(std::forward<Args>(args)...);
         }
-        else if (size_ == data_.Capacity()) { // need new heap            
-            RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
+        else if (size_ == Capacity()) { // need new heap
+            RawMemory<T, Alloc> new_data = AllocateGrownBuffer(size_ + 1);
             new (new_data.GetAddress() + pos_count) T(std::forward<Args>(args)...); // create new value in heap
-            TransferDataToNewHeap(data_.GetAddress(), pos_count, new_data.GetAddress());
+            TransferDataToNewHeap(Data(), pos_count, new_data.GetAddress());
             size_t dist_to_end = std::distance(pos, cend()); // qty of leemnts after desired pos
-            TransferDataToNewHeap(data_.GetAddress() + pos_count, dist_to_end, new_data.GetAddress() + pos_count + 1);
-            std::destroy_n(data_.GetAddress(), size_);
+            TransferDataToNewHeap(Data() + pos_count, dist_to_end, new_data.GetAddress() + pos_count + 1);
+            std::destroy_n(Data(), size_);
             data_.Swap(new_data);
             ++size_;
         }
         else {
             T tmp(std::forward<Args>(args)...);
-            std::uninitialized_move_n(end() - 1, 1, end()); // move last element right on uninitilized address 
-            std::move_backward(begin() + pos_count, end() - 1, end()); // shift elements after pos right on one step
-            *(data_.GetAddress() + pos_count) = std::move(tmp); // move tmp value to pos vector element
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                std::memmove(Data() + pos_count + 1, Data() + pos_count, (size_ - pos_count) * sizeof(T)); // shift whole tail in one call
+            }
+            else {
+                std::uninitialized_move_n(end() - 1, 1, end()); // move last element right on uninitilized address
+                std::move_backward(begin() + pos_count, end() - 1, end()); // shift elements after pos right on one step
+            }
+            *(Data() + pos_count) = std::move(tmp); // move tmp value to pos vector element
             ++size_;
         }
         return begin() + pos_count;
@@ -281,6 +907,46 @@ public:
         return Emplace(pos, std::move(value));
     }
 
+    // Insert a whole range before pos with one growth decision and a single
+    // shift of the tail, instead of one shift per element as with repeated
+    // Insert calls. The range must not point into this vector.
+    template <typename InputIt>
+    iterator InsertRange(const_iterator pos, InputIt first, InputIt last) {
+        size_t pos_count = std::distance(cbegin(), pos);
+        size_t count = std::distance(first, last);
+        if (count == 0) {
+            return begin() + pos_count;
+        }
+        if (size_ + count > Capacity()) { // need new heap - build it in place, no shift at all
+            RawMemory<T, Alloc> new_data = AllocateGrownBuffer(size_ + count);
+            std::uninitialized_copy(first, last, new_data.GetAddress() + pos_count);
+            TransferDataToNewHeap(Data(), pos_count, new_data.GetAddress());
+            TransferDataToNewHeap(Data() + pos_count, size_ - pos_count, new_data.GetAddress() + pos_count + count);
+            std::destroy_n(Data(), size_);
+            data_.Swap(new_data);
+        }
+        else {
+            size_t tail = size_ - pos_count;
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                std::memmove(Data() + pos_count + count, Data() + pos_count, tail * sizeof(T)); // whole tail in one call
+                std::uninitialized_copy(first, last, Data() + pos_count);
+            }
+            else if (count < tail) { // the gap lands fully inside existing elements
+                std::uninitialized_move_n(end() - count, count, end());
+                std::move_backward(begin() + pos_count, end() - count, end());
+                std::copy(first, last, begin() + pos_count);
+            }
+            else { // the whole tail jumps into raw memory past the gap
+                std::uninitialized_move_n(begin() + pos_count, tail, begin() + pos_count + count);
+                InputIt mid = std::next(first, tail);
+                std::copy(first, mid, begin() + pos_count); // assign over the moved-from slots
+                std::uninitialized_copy(mid, last, begin() + pos_count + tail);
+            }
+        }
+        size_ += count;
+        return begin() + pos_count;
+    }
+
     iterator Erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
         if (cend() == pos) {
             PopBack(); // remove last element
@@ -294,22 +960,418 @@ public:
         }
     }
 
+    iterator Erase(const_iterator first, const_iterator last) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        assert(cbegin() <= first && first <= last && last <= cend());
+        size_t first_count = std::distance(cbegin(), first);
+        size_t count = std::distance(first, last);
+        if (count != 0) {
+            std::move(begin() + first_count + count, end(), begin() + first_count); // single compaction pass for the whole range
+            std::destroy_n(end() - count, count);
+            size_ -= count;
+        }
+        return begin() + first_count;
+    }
+
+    // O(1) erase for callers that don't care about element order:
+    // the last element takes the place of the removed one.
+    iterator EraseUnordered(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        assert(cbegin() <= pos && pos < cend());
+        size_t pos_count = std::distance(cbegin(), pos);
+        if (pos_count + 1 != size_) {
+            Data()[pos_count] = std::move(Data()[size_ - 1]);
+        }
+        PopBack();
+        return begin() + pos_count;
+    }
+
+    /////_SEARCH_/////////////////////////////////////////////////////////////////
+    // First element equal to value, end() if absent. 4/8-byte integers go
+    // through the explicit SIMD kernels above; everything else scans scalar.
+    const_iterator Find(const T& value) const noexcept {
+        if constexpr (std::is_integral_v<T> && sizeof(T) == 4) {
+            return begin() + simd_detail::FindEq32(reinterpret_cast<const int32_t*>(Data()), size_, static_cast<int32_t>(value));
+        }
+        else if constexpr (std::is_integral_v<T> && sizeof(T) == 8) {
+            return begin() + simd_detail::FindEq64(reinterpret_cast<const int64_t*>(Data()), size_, static_cast<int64_t>(value));
+        }
+        else {
+            return std::find(begin(), end(), value);
+        }
+    }
+
+    iterator Find(const T& value) noexcept {
+        return begin() + (const_cast<const Vector&>(*this).Find(value) - cbegin());
+    }
+
+    bool Contains(const T& value) const noexcept {
+        return Find(value) != end();
+    }
+
+    /////_BLOCK ITERATION_/////////////////////////////////////////////////////////
+    // Tiled traversal for scan loops that stall on memory: Blocks(n) yields
+    // contiguous n-element spans, and producing a span issues software
+    // prefetch for every cache line of the NEXT one, so the lines arrive
+    // while the current tile is being processed. The default tile is 16KB
+    // of elements - small enough to live in L1 next to the consumer's own
+    // working set. ForEach is the plain elementwise loop over those tiles.
+    template <bool IsConst>
+    struct BasicBlock { // contiguous span of elements, usable in a range-for
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+
+        pointer data = nullptr;
+        size_t count = 0;
+
+        pointer begin() const noexcept {
+            return data;
+        }
+        pointer end() const noexcept {
+            return data + count;
+        }
+        size_t Size() const noexcept {
+            return count;
+        }
+    };
+    using Block = BasicBlock<false>;
+    using ConstBlock = BasicBlock<true>;
+
+    template <bool IsConst>
+    class BasicBlockIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = BasicBlock<IsConst>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = value_type; // spans are cheap, yielded by value
+
+        BasicBlockIterator() = default;
+        BasicBlockIterator(typename value_type::pointer current, typename value_type::pointer last, size_t block_elements) noexcept
+            :current_(current)
+            , last_(last)
+            , block_elements_(block_elements) {
+        }
+
+        reference operator*() const noexcept {
+            size_t count = std::min(block_elements_, static_cast<size_t>(last_ - current_));
+            size_t next_count = std::min(block_elements_, static_cast<size_t>(last_ - (current_ + count)));
+            PrefetchRange(current_ + count, current_ + count + next_count);
+            return { current_, count };
+        }
+
+        BasicBlockIterator& operator++() noexcept {
+            current_ += std::min(block_elements_, static_cast<size_t>(last_ - current_));
+            return *this;
+        }
+        BasicBlockIterator operator++(int) noexcept {
+            BasicBlockIterator old(*this);
+            ++(*this);
+            return old;
+        }
+
+        bool operator==(const BasicBlockIterator& rhs) const noexcept {
+            return current_ == rhs.current_;
+        }
+        bool operator!=(const BasicBlockIterator& rhs) const noexcept {
+            return !(*this == rhs);
+        }
+
+    private:
+        typename value_type::pointer current_ = nullptr;
+        typename value_type::pointer last_ = nullptr;
+        size_t block_elements_ = 0;
+
+        static void PrefetchRange(const T* first, const T* last) noexcept {
+            constexpr size_t kCacheLineBytes = 64;
+            const char* p = reinterpret_cast<const char*>(first);
+            const char* e = reinterpret_cast<const char*>(last);
+            for (; p < e; p += kCacheLineBytes) {
+                VECTOR_PREFETCH(p);
+            }
+        }
+    };
+
+    template <bool IsConst>
+    class BasicBlockRange { // what Blocks() returns; only good for a range-for
+    public:
+        BasicBlockRange(typename BasicBlock<IsConst>::pointer first, typename BasicBlock<IsConst>::pointer last, size_t block_elements) noexcept
+            :first_(first)
+            , last_(last)
+            , block_elements_(block_elements) {
+        }
+
+        BasicBlockIterator<IsConst> begin() const noexcept {
+            return { first_, last_, block_elements_ };
+        }
+        BasicBlockIterator<IsConst> end() const noexcept {
+            return { last_, last_, block_elements_ };
+        }
+
+    private:
+        typename BasicBlock<IsConst>::pointer first_ = nullptr;
+        typename BasicBlock<IsConst>::pointer last_ = nullptr;
+        size_t block_elements_ = 0;
+    };
+
+    static constexpr size_t kDefaultBlockElements = 16 * 1024 / sizeof(T) > 0 ? 16 * 1024 / sizeof(T) : 1;
+
+    BasicBlockRange<false> Blocks(size_t block_elements = kDefaultBlockElements) noexcept {
+        assert(block_elements > 0);
+        return { Data(), Data() + size_, block_elements };
+    }
+    BasicBlockRange<true> Blocks(size_t block_elements = kDefaultBlockElements) const noexcept {
+        assert(block_elements > 0);
+        return { Data(), Data() + size_, block_elements };
+    }
+
+    template <typename Fn>
+    void ForEach(Fn fn, size_t block_elements = kDefaultBlockElements) {
+        for (Block block : Blocks(block_elements)) {
+            for (T& value : block) {
+                fn(value);
+            }
+        }
+    }
+    template <typename Fn>
+    void ForEach(Fn fn, size_t block_elements = kDefaultBlockElements) const {
+        for (ConstBlock block : Blocks(block_elements)) {
+            for (const T& value : block) {
+                fn(value);
+            }
+        }
+    }
+
+    /////_BUFFER OWNERSHIP HANDOFF_//////////////////////////////////////////////
+    // Zero-copy adoption of an external buffer already holding `size`
+    // constructed elements. Requires an adoption-aware allocator - see
+    // AdoptedVector<T> / ExternalBufferAllocation; the deleter is invoked
+    // on the adopted buffer once the vector is done with it.
+    template <typename A = Alloc> // template so that only adoption-aware allocators need a Deleter type
+    static Vector Adopt(T* buf, size_t size, size_t capacity, typename A::Deleter deleter) noexcept {
+        static_assert(std::is_same_v<A, Alloc>, "A is deduced, do not pass it explicitly");
+        static_assert(InlineCapacity == 0, "adoption bypasses the inline buffer");
+        assert(size <= capacity);
+        Alloc alloc;
+        alloc.adopted_ = buf;
+        alloc.deleter_ = deleter;
+        Vector v;
+        v.data_ = RawMemory<T, Alloc>(buf, capacity, alloc);
+        v.size_ = size;
+        return v;
+    }
+
+    // Transfers buffer ownership out: returns the pointer and neuters the
+    // vector. Elements are NOT destroyed - the new owner takes over both
+    // the element lifetimes and freeing the buffer.
+    T* Release() noexcept {
+        assert(!UsingInlineStorage());
+        size_ = 0;
+        return data_.Release();
+    }
+
     /////_OTHER_//////////////////////////////////////////////////////////////////
-    void Swap(Vector& other) noexcept {
-        data_.Swap(other.data_);
+    void Swap(Vector& other) noexcept(kSwapIsNoexcept) {
+        if constexpr (kHasInline) {
+            if (!UsingInlineStorage() && !other.UsingInlineStorage()) { // both on heap - cheap pointer swap
+                data_.Swap(other.data_);
+            }
+            else if (UsingInlineStorage() && other.UsingInlineStorage()) { // both inline - swap elements one by one
+                SwapInlineElements(other);
+            }
+            else { // mixed case: move inline elements over, then hand the heap buffer to the other side
+                Vector& inline_side = UsingInlineStorage() ? *this : other;
+                Vector& heap_side = UsingInlineStorage() ? other : *this;
+                std::uninitialized_move_n(inline_side.Data(), inline_side.size_, heap_side.InlineAddress());
+                std::destroy_n(inline_side.Data(), inline_side.size_);
+                data_.Swap(other.data_); // now inline_side owns the heap buffer, heap_side is inline
+            }
+        }
+        else {
+            data_.Swap(other.data_);
+        }
         std::swap(size_, other.size_);
     }
 
 private:
-    RawMemory<T> data_;
+    RawMemory<T, Alloc> data_;
     size_t size_ = 0;
 
+    static constexpr bool kHasInline = InlineCapacity > 0;
+    static constexpr bool kSwapIsNoexcept = !kHasInline
+        || (std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>);
+
+    // Inline storage is in use until the first heap allocation; a heap buffer
+    // is always bigger than InlineCapacity, so we never go back.
+    bool UsingInlineStorage() const noexcept {
+        return kHasInline && data_.Capacity() == 0;
+    }
+
+    static size_t HeapCapacityFor(size_t n) noexcept { // capacity to request from heap, 0 if inline buffer is enough
+        return n <= InlineCapacity ? 0 : n;
+    }
+
+    void ReserveForAppend(size_t count) { // one growth decision for a whole batch, keeps growth amortization
+        if (size_ + count > Capacity()) {
+            Reserve(Growth::Next(Capacity(), size_ + count));
+        }
+    }
+
+    RawMemory<T, Alloc> AllocateGrownBuffer(size_t required) { // the only place where the growth policy is consulted
+        size_t new_capacity = Growth::Next(Capacity(), required);
+        NoteReallocation(new_capacity);
+        return RawMemory<T, Alloc>(new_capacity, data_.GetAllocator());
+    }
+
+#if defined(VECTOR_TELEMETRY)
+    static void NoteReallocation(size_t new_capacity) noexcept {
+        VectorTelemetryStats& stats = VectorTelemetryFor<T>();
+        ++stats.reallocations;
+        UpdateVectorTelemetryMax(stats.peak_capacity, new_capacity);
+    }
+    static void NoteTransfer(size_t count, bool copied) noexcept {
+        VectorTelemetryStats& stats = VectorTelemetryFor<T>();
+        stats.bytes_transferred += count * sizeof(T);
+        (copied ? stats.element_copies : stats.element_moves) += count;
+    }
+#else
+    static void NoteReallocation(size_t /*new_capacity*/) noexcept {
+    }
+    static void NoteTransfer(size_t /*count*/, bool /*copied*/) noexcept {
+    }
+#endif
+
+    static constexpr size_t kParallelGrain = 4096; // per-thread minimum, below this threads cost more than they save
+
+    static size_t ParallelWorkerCount(size_t count, size_t thread_count) noexcept {
+        return std::min(thread_count, count / kParallelGrain);
+    }
+
+    static void ConstructRangeParallel(T* first, size_t count, size_t thread_count) {
+        size_t workers = ParallelWorkerCount(count, thread_count);
+        size_t chunk = (count + workers - 1) / workers;
+        Vector<size_t> constructed(workers); // how many elements each worker committed
+        Vector<std::exception_ptr> errors(workers);
+        {
+            Vector<std::thread> threads;
+            threads.Reserve(workers);
+            for (size_t w = 0; w < workers; ++w) {
+                threads.EmplaceBack([=, &constructed, &errors] {
+                    size_t from = w * chunk;
+                    size_t to = std::min(count, from + chunk);
+                    size_t done = 0;
+                    try {
+                        for (size_t i = from; i < to; ++i) {
+                            new (first + i) T();
+                            ++done;
+                        }
+                    }
+                    catch (...) {
+                        std::destroy_n(first + from, done); // roll back own partition
+                        done = 0;
+                        errors[w] = std::current_exception();
+                    }
+                    constructed[w] = done;
+                });
+            }
+            for (size_t w = 0; w < workers; ++w) {
+                threads[w].join();
+            }
+        }
+        for (size_t w = 0; w < workers; ++w) {
+            if (errors[w] != nullptr) { // undo the partitions that did succeed and report
+                for (size_t w2 = 0; w2 < workers; ++w2) {
+                    std::destroy_n(first + w2 * chunk, constructed[w2]);
+                }
+                std::rethrow_exception(errors[w]);
+            }
+        }
+    }
+
+    static void DestroyRangeParallel(T* first, size_t count, size_t thread_count) noexcept {
+        size_t workers = ParallelWorkerCount(count, thread_count);
+        size_t chunk = (count + workers - 1) / workers;
+        Vector<std::thread> threads;
+        threads.Reserve(workers);
+        for (size_t w = 0; w < workers; ++w) {
+            threads.EmplaceBack([=] {
+                size_t from = w * chunk;
+                size_t to = std::min(count, from + chunk);
+                std::destroy_n(first + from, to - from);
+            });
+        }
+        for (size_t w = 0; w < workers; ++w) {
+            threads[w].join();
+        }
+    }
+
+    T* Data() noexcept {
+        return UsingInlineStorage() ? this->InlineAddress() : data_.GetAddress();
+    }
+    const T* Data() const noexcept {
+        return UsingInlineStorage() ? this->InlineAddress() : data_.GetAddress();
+    }
+
+    void SwapInlineElements(Vector& other) { // both vectors live in their inline buffers
+        Vector& shorter = size_ <= other.size_ ? *this : other;
+        Vector& longer = size_ <= other.size_ ? other : *this;
+        std::swap_ranges(shorter.Data(), shorter.Data() + shorter.size_, longer.Data());
+        std::uninitialized_move_n(longer.Data() + shorter.size_, longer.size_ - shorter.size_, shorter.Data() + shorter.size_); // move the excess tail
+        std::destroy_n(longer.Data() + shorter.size_, longer.size_ - shorter.size_);
+    }
+
     void TransferDataToNewHeap(iterator src, size_t size, iterator dst) {
-        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) { // move or copy old values to new heap
+        if constexpr (std::is_trivially_copyable_v<T>) { // whole block at once, no per-element loop
+            if (size != 0) {
+                std::memcpy(dst, src, size * sizeof(T));
+            }
+            NoteTransfer(size, false);
+        }
+        else if constexpr (std::is_same_v<Guarantee, GuaranteeBasic> // caller opted out of the strong guarantee
+            || std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) { // move or copy old values to new heap
             std::uninitialized_move_n(src, size, dst);
+            NoteTransfer(size, false);
         }
         else {
             std::uninitialized_copy_n(src, size, dst);
+            NoteTransfer(size, true);
         }
     }
 };
+
+/////_COMPARISON_/////////////////////////////////////
+// Element-wise equality. Integer-like types (where byte equality IS value
+// equality) compare as one memcmp the compiler expands to wide loads; the
+// rest go through std::equal and the element's own operator==.
+template <typename T, size_t InlineCapacity, typename Alloc, typename Growth, typename Guarantee>
+bool operator==(const Vector<T, InlineCapacity, Alloc, Growth, Guarantee>& lhs,
+    const Vector<T, InlineCapacity, Alloc, Growth, Guarantee>& rhs) noexcept {
+    if (lhs.Size() != rhs.Size()) {
+        return false;
+    }
+    if constexpr (std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) {
+        return lhs.Size() == 0 || std::memcmp(lhs.begin(), rhs.begin(), lhs.Size() * sizeof(T)) == 0;
+    }
+    else {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+}
+
+template <typename T, size_t InlineCapacity, typename Alloc, typename Growth, typename Guarantee>
+bool operator!=(const Vector<T, InlineCapacity, Alloc, Growth, Guarantee>& lhs,
+    const Vector<T, InlineCapacity, Alloc, Growth, Guarantee>& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+/////_ALIASES_/////////////////////////////////////
+// Vector whose heap buffer is always Align-byte aligned, for SIMD kernels.
+template <typename T, size_t Align = 64>
+using AlignedVector = Vector<T, 0, AlignedAllocation<T, Align>>;
+
+// Vector that can take ownership of external buffers via Adopt and hand
+// them back via Release, for zero-copy I/O handoff.
+template <typename T>
+using AdoptedVector = Vector<T, 0, ExternalBufferAllocation<T>>;
+
+#if defined(__linux__)
+// Vector whose large buffers are backed by transparent huge pages.
+template <typename T>
+using HugePageVector = Vector<T, 0, HugePageAllocation<T>>;
+#endif